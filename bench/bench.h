@@ -0,0 +1,103 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+#include "logging/logger.h"
+
+// keeps the optimizer from discarding a value that is otherwise unused
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+struct benchResult {
+    std::string name;
+    uint64_t iterations = 0;  //iterations per run
+    double nsPerOp = 0.0;     //median over all runs
+    double minNs = 0.0;
+    double maxNs = 0.0;
+};
+
+// BENCH - minimal in-tree harness, each benchmark runs its body for a requested number of iterations
+class bench {
+public:
+    using function = std::function<void(uint64_t iterations)>;
+
+    void add(std::string name, function body) {
+        _benchmarks.push_back({ std::move(name), std::move(body) });
+    }
+
+    void run(const std::string& filter) {
+        for (auto& [name, body] : _benchmarks) {
+            if (!filter.empty() && name.find(filter) == std::string::npos) continue;
+            _results.push_back(measure(name, body));
+            const auto& result = _results.back();
+            _log.info("{:<32} {:>12.2f} ns/op  (min {:.2f}, max {:.2f}, {} iterations)",
+                      result.name, result.nsPerOp, result.minNs, result.maxNs, result.iterations);
+        }
+    }
+
+    bool writeJson(const std::string& filePath) const {
+        std::ofstream file(filePath);
+        if (!file) {
+            _log.warn("Failed to open benchmark output: {}", filePath);
+            return false;
+        }
+        file << "{\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < _results.size(); i++) {
+            const auto& result = _results[i];
+            file << std::format("    {{\"name\": \"{}\", \"iterations\": {}, \"ns_per_op\": {:.3f}, \"min_ns\": {:.3f}, \"max_ns\": {:.3f}}}{}\n",
+                                result.name, result.iterations, result.nsPerOp, result.minNs, result.maxNs,
+                                i + 1 < _results.size() ? "," : "");
+        }
+        file << "  ]\n}\n";
+        return true;
+    }
+private:
+    using clock = std::chrono::steady_clock;
+    static constexpr int RUNS = 7;
+    static constexpr double MIN_RUN_NS = 50'000'000.0; //50 ms per run
+
+    static double time(const function& body, const uint64_t iterations) {
+        const auto start = clock::now();
+        body(iterations);
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    }
+
+    static benchResult measure(const std::string& name, const function& body) {
+        // grow the iteration count until a single run is long enough to time reliably
+        uint64_t iterations = 1;
+        double elapsed = time(body, iterations);
+        while (elapsed < MIN_RUN_NS && iterations < (1ull << 40)) {
+            const double scale = elapsed > 0.0 ? MIN_RUN_NS / elapsed * 1.2 : 10.0;
+            iterations = std::max<uint64_t>(iterations + 1, static_cast<uint64_t>(iterations * std::min(scale, 10.0)));
+            elapsed = time(body, iterations);
+        }
+        std::vector<double> samples;
+        for (int run = 0; run < RUNS; run++) {
+            samples.push_back(time(body, iterations) / static_cast<double>(iterations));
+        }
+        std::ranges::sort(samples);
+        return { name, iterations, samples[RUNS / 2], samples.front(), samples.back() };
+    }
+
+    std::vector<std::pair<std::string, function>> _benchmarks;
+    std::vector<benchResult> _results;
+    static inline logger<> _log;
+};
+
+void registerMathBenchmarks(bench& suite);
+void registerInputBenchmarks(bench& suite);
+void registerLoggerBenchmarks(bench& suite);
+void registerRenderingBenchmarks(bench& suite);
+void registerJobBenchmarks(bench& suite);
+void registerEcsBenchmarks(bench& suite);
@@ -0,0 +1,42 @@
+#include "bench.h"
+#include <memory>
+#include "ecs/scene.h"
+
+// built on first use, the job system is not running yet when benchmarks are registered
+static scene& benchScene() {
+    static std::unique_ptr<scene> instance;
+    if (!instance) {
+        instance = std::make_unique<scene>();
+        instance->setCamera(Mat4::lookAt({0, 0, -5}, {0, 0, 0}), Mat4::perspective(60.0f, 16.0f / 9.0f, 0.1f, 100.0f));
+        instance->init(100000, Vec3(-0.25f, -0.25f, 0.0f), Vec3(0.25f, 0.25f, 0.0f));
+    }
+    return *instance;
+}
+
+static void composeTransform(const previousTransform& previous, const transform& current, worldTransform& placed) {
+    placed.matrix = Mat4::translation(previous.position.lerp(current.position, 0.5f)) * Mat4::rotationZ(current.angle) * Mat4::scale(current.scale);
+}
+
+void registerEcsBenchmarks(bench& suite) {
+    suite.add("ecs/each transforms 100k", [](const uint64_t iterations) {
+        world& entities = benchScene().getWorld();
+        for (uint64_t i = 0; i < iterations; i++) {
+            entities.each<const previousTransform, const transform, worldTransform>(composeTransform);
+        }
+    });
+    suite.add("ecs/parallelEach transforms 100k", [](const uint64_t iterations) {
+        world& entities = benchScene().getWorld();
+        for (uint64_t i = 0; i < iterations; i++) {
+            entities.parallelEach<const previousTransform, const transform, worldTransform>(composeTransform, 4);
+        }
+    });
+    suite.add("ecs/update and extract 100k", [](const uint64_t iterations) {
+        scene& objects = benchScene();
+        frameSnapshot snapshot;
+        for (uint64_t i = 0; i < iterations; i++) {
+            objects.fixedUpdate(timestep(1.0 / 60.0));
+            objects.extract(0.5f, snapshot);
+            doNotOptimize(snapshot.models.data());
+        }
+    });
+}
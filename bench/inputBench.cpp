@@ -0,0 +1,38 @@
+#include "bench.h"
+#include <GLFW/glfw3.h>
+#include "input/input.h"
+#include "input/keycodes.h"
+
+void registerInputBenchmarks(bench& suite) {
+    // touch every printable and function key so update walks a realistic table
+    for (int code = key.space; code <= key.last; code++) {
+        input::onKeyEvent(code, GLFW_PRESS);
+    }
+    suite.add("input/update", [](const uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            input::update(timestep(1.0f / 60.0f));
+        }
+    });
+    suite.add("input/getKey", [](const uint64_t iterations) {
+        int pressed = 0;
+        for (uint64_t i = 0; i < iterations; i++) {
+            pressed += input::getKey(key.space + static_cast<int>(i % 64));
+        }
+        doNotOptimize(pressed);
+    });
+    suite.add("input/getKeyDown", [](const uint64_t iterations) {
+        int pressed = 0;
+        for (uint64_t i = 0; i < iterations; i++) {
+            pressed += input::getKeyDown(key.space + static_cast<int>(i % 64));
+        }
+        doNotOptimize(pressed);
+    });
+    suite.add("input/event queue", [](const uint64_t iterations) {
+        size_t consumed = 0;
+        for (uint64_t i = 0; i < iterations; i++) {
+            input::onMouseMoveEvent(static_cast<float>(i), 0.0f);
+            consumed += input::consumeEvents([](const inputEvent& event) { doNotOptimize(event); });
+        }
+        doNotOptimize(consumed);
+    });
+}
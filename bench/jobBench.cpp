@@ -0,0 +1,29 @@
+#include "bench.h"
+#include <cmath>
+#include <vector>
+#include "core/jobSystem.h"
+
+void registerJobBenchmarks(bench& suite) {
+    static std::vector<float> values(1 << 20, 1.0f);
+    suite.add("jobs/serial 1M", [](const uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            for (float& value : values) value = std::sqrt(value + 1.0f);
+            doNotOptimize(values.data());
+        }
+    });
+    suite.add("jobs/parallelFor 1M", [](const uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            jobSystem::parallelFor(std::span<float>(values), 16384, [](const std::span<float> chunk) {
+                for (float& value : chunk) value = std::sqrt(value + 1.0f);
+            });
+            doNotOptimize(values.data());
+        }
+    });
+    suite.add("jobs/run and wait", [](const uint64_t iterations) {
+        jobCounter counter;
+        for (uint64_t i = 0; i < iterations; i++) {
+            jobSystem::run([] {}, &counter);
+        }
+        jobSystem::wait(counter);
+    });
+}
@@ -0,0 +1,76 @@
+#include "bench.h"
+
+// discards everything so the benchmark measures the logger and not the terminal
+class nullSink : public logSink {
+public:
+    void write(const logRecord& record) override { doNotOptimize(record); }
+    void flush() override {}
+};
+
+// swaps the console for a null sink for the lifetime of one benchmark run
+class quietLogging {
+public:
+    explicit quietLogging(const bool async, const bool deferred = true) : _async(async) {
+        logBackend::clearSinks();
+        logBackend::addSink(std::make_shared<nullSink>());
+        logBackend::setDeferredFormatting(deferred);
+        if (_async) logBackend::startAsync();
+    }
+    ~quietLogging() {
+        if (_async) logBackend::stopAsync();
+        logBackend::setDeferredFormatting(true);
+        logBackend::clearSinks();
+        logBackend::addSink(std::make_shared<consoleSink>());
+    }
+private:
+    bool _async;
+};
+
+void registerLoggerBenchmarks(bench& suite) {
+    suite.add("logger/info", [](const uint64_t iterations) {
+        static logger<> log;
+        quietLogging quiet(false);
+        for (uint64_t i = 0; i < iterations; i++) {
+            log.info("frame {} took {:.3f} ms", i, 16.6f);
+        }
+    });
+    suite.add("logger/info async", [](const uint64_t iterations) {
+        static logger<> log;
+        quietLogging quiet(true);
+        for (uint64_t i = 0; i < iterations; i++) {
+            log.info("frame {} took {:.3f} ms", i, 16.6f);
+        }
+    });
+    suite.add("logger/info async eager", [](const uint64_t iterations) {
+        static logger<> log;
+        quietLogging quiet(true, false);
+        for (uint64_t i = 0; i < iterations; i++) {
+            log.info("frame {} took {:.3f} ms", i, 16.6f);
+        }
+    });
+    suite.add("logger/info filtered", [](const uint64_t iterations) {
+        static logger<> log;
+        quietLogging quiet(false);
+        logBackend::setLevel(LogLevel::WARN);
+        for (uint64_t i = 0; i < iterations; i++) {
+            log.info("frame {} took {:.3f} ms", i, 16.6f);
+        }
+        logBackend::setLevel(LogLevel::TEST);
+    });
+    suite.add("logger/info filtered macro", [](const uint64_t iterations) {
+        static logger<> log;
+        quietLogging quiet(false);
+        logBackend::setLevel(LogLevel::WARN);
+        for (uint64_t i = 0; i < iterations; i++) {
+            SKETCH_LOG_INFO(log, "frame {} took {:.3f} ms", i, 16.6f);
+        }
+        logBackend::setLevel(LogLevel::TEST);
+    });
+    suite.add("logger/debug", [](const uint64_t iterations) {
+        static logger<> log;
+        quietLogging quiet(false);
+        for (uint64_t i = 0; i < iterations; i++) {
+            log.debug("frame {} took {:.3f} ms", i, 16.6f);
+        }
+    });
+}
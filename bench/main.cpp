@@ -0,0 +1,55 @@
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+#include "bench.h"
+#include "core/jobSystem.h"
+
+// usage: sketch_bench [--filter=substring] [--json=path]
+int main(const int argc, char** argv) {
+    logger<> log;
+    std::string filter;
+    std::string jsonPath;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg.starts_with("--filter=")) filter = arg.substr(9);
+        else if (arg.starts_with("--json=")) jsonPath = arg.substr(7);
+        else log.warn("Unknown argument: {}", arg);
+    }
+
+    // hidden window so shader and texture benchmarks have a context, skipped when there is no display
+    GLFWwindow* window = nullptr;
+    if (glfwInit()) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+#ifdef __APPLE__
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+        window = glfwCreateWindow(64, 64, "sketch_bench", nullptr, nullptr);
+        if (window) {
+            glfwMakeContextCurrent(window);
+            if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
+                glfwMakeContextCurrent(nullptr);
+            }
+        }
+    }
+
+    bench suite;
+    registerMathBenchmarks(suite);
+    registerInputBenchmarks(suite);
+    registerLoggerBenchmarks(suite);
+    registerRenderingBenchmarks(suite);
+    registerJobBenchmarks(suite);
+    registerEcsBenchmarks(suite);
+    jobSystem::init();
+    suite.run(filter);
+    jobSystem::shutdown();
+    if (!jsonPath.empty()) {
+        suite.writeJson(jsonPath);
+    }
+
+    if (window) glfwDestroyWindow(window);
+    glfwTerminate();
+    return 0;
+}
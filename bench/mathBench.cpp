@@ -0,0 +1,38 @@
+#include "bench.h"
+#include "math/math.h"
+
+void registerMathBenchmarks(bench& suite) {
+    suite.add("math/Mat4::operator*", [](const uint64_t iterations) {
+        Mat4 a = Mat4::rotationY(30.0f);
+        const Mat4 b = Mat4::translation({ 1.0f, 2.0f, 3.0f });
+        for (uint64_t i = 0; i < iterations; i++) {
+            a = a * b;
+            doNotOptimize(a);
+        }
+    });
+    suite.add("math/Mat4::lookAt", [](const uint64_t iterations) {
+        Vec3 target(0.0f, 0.0f, -5.0f);
+        const Vec3 camera(0.0f, 0.0f, 0.0f);
+        for (uint64_t i = 0; i < iterations; i++) {
+            doNotOptimize(target);
+            const Mat4 view = Mat4::lookAt(target, camera);
+            doNotOptimize(view);
+        }
+    });
+    suite.add("math/Mat4::perspective", [](const uint64_t iterations) {
+        float fov = 60.0f;
+        for (uint64_t i = 0; i < iterations; i++) {
+            doNotOptimize(fov);
+            const Mat4 projection = Mat4::perspective(fov, 16.0f / 9.0f, 0.1f, 100.0f);
+            doNotOptimize(projection);
+        }
+    });
+    suite.add("math/Vec3::normalize", [](const uint64_t iterations) {
+        Vec3 v(1.0f, 2.0f, 3.0f);
+        for (uint64_t i = 0; i < iterations; i++) {
+            doNotOptimize(v);
+            const Vec3 n = v.normalize();
+            doNotOptimize(n);
+        }
+    });
+}
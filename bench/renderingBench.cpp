@@ -0,0 +1,119 @@
+#include "bench.h"
+#include <filesystem>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include "rendering/shaders/shader.h"
+#include "math/math.h"
+#include "utils/texture.h"
+#include "rendering/commandBuffer.h"
+#include "core/jobSystem.h"
+#include "core/resourcePool.h"
+#include "stb_image.h"
+
+static constexpr const char* VERTEX_PATH = "../src/rendering/shaders/triangle.vert";
+static constexpr const char* FRAGMENT_PATH = "../src/rendering/shaders/triangle.frag";
+static constexpr const char* TEXTURE_PATH = "../src/assets/test.png";
+static logger<> benchLog;
+
+void registerRenderingBenchmarks(bench& suite) {
+    if (std::filesystem::exists(TEXTURE_PATH)) {
+        suite.add("texture/decode", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                int width, height, channels;
+                stbi_uc* data = stbi_load(TEXTURE_PATH, &width, &height, &channels, 0);
+                doNotOptimize(data);
+                stbi_image_free(data);
+            }
+        });
+    } else {
+        benchLog.warn("Skipping texture benchmarks, {} not found", TEXTURE_PATH);
+    }
+
+    suite.add("render/record and merge 10k packets", [](const uint64_t iterations) {
+        static const std::vector<Mat4> models(10000, Mat4::translation({ 1.0f, 2.0f, 3.0f }));
+        static frameArena arena;
+        static commandQueue commands;
+        for (uint64_t i = 0; i < iterations; i++) {
+            arena.begin();
+            commands.begin(arena);
+            jobSystem::parallelFor(std::span(models), 256, [](const std::span<const Mat4> chunk) {
+                commandBuffer& buffer = commands.local();
+                for (const Mat4& model : chunk) {
+                    drawPacket packet;
+                    packet.model = model;
+                    packet.indexCount = 6;
+                    packet.object = static_cast<uint32_t>(&model - models.data());
+                    buffer.draw(packet);
+                }
+            });
+            doNotOptimize(commands.merge().data());
+            arena.reset();
+        }
+    });
+    suite.add("memory/pmr vector 1k in frame arena", [](const uint64_t iterations) {
+        static linearArena arena;
+        for (uint64_t i = 0; i < iterations; i++) {
+            std::pmr::vector<Mat4> items(&arena);
+            for (int j = 0; j < 1000; j++) items.emplace_back();
+            doNotOptimize(items.data());
+            arena.reset();
+        }
+    });
+    suite.add("memory/std vector 1k on the heap", [](const uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            std::vector<Mat4> items;
+            for (int j = 0; j < 1000; j++) items.emplace_back();
+            doNotOptimize(items.data());
+        }
+    });
+
+    suite.add("resources/pool create and destroy", [](const uint64_t iterations) {
+        static resourcePool<Mat4> pool;
+        for (uint64_t i = 0; i < iterations; i++) {
+            const handle<Mat4> created = pool.create();
+            doNotOptimize(pool.get(created));
+            pool.destroy(created);
+        }
+    });
+    suite.add("resources/pool get 1k", [](const uint64_t iterations) {
+        static resourcePool<Mat4> pool;
+        static std::vector<handle<Mat4>> handles;
+        while (handles.size() < 1000) handles.push_back(pool.create());
+        for (uint64_t i = 0; i < iterations; i++) {
+            for (const handle<Mat4> resource : handles) {
+                doNotOptimize(pool.get(resource));
+            }
+        }
+    });
+
+    // everything below needs the hidden context created in main
+    if (!glfwGetCurrentContext()) {
+        benchLog.warn("Skipping GL benchmarks, no OpenGL context");
+        return;
+    }
+    if (!std::filesystem::exists(VERTEX_PATH) || !std::filesystem::exists(FRAGMENT_PATH)) {
+        benchLog.warn("Skipping shader benchmarks, shader sources not found");
+        return;
+    }
+    static shader program(VERTEX_PATH, FRAGMENT_PATH);
+    program.use();
+    suite.add("shader/setMatrix4", [](const uint64_t iterations) {
+        const Mat4 model = Mat4::translation({ 0.0f, 0.0f, 0.0f });
+        for (uint64_t i = 0; i < iterations; i++) {
+            program.setMatrix4("model", &model.m[0][0]);
+        }
+    });
+    suite.add("shader/setInt", [](const uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            program.setInt("texture1", 0);
+        }
+    });
+    if (std::filesystem::exists(TEXTURE_PATH)) {
+        suite.add("texture/loadFromSTB", [](const uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                texture tex;
+                doNotOptimize(tex.loadFromSTB(TEXTURE_PATH));
+            }
+        });
+    }
+}
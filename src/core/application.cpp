@@ -1,139 +1,331 @@
-#include "application.h"
-
-constexpr float vertices[] = {
-    -0.25f, -0.25f, 0.0f, //position
-     0.0f,  0.0f, 0.0f, //color
-     0.0f,  0.0f, 1.0f, //normal
-     1.0f,  0.0f,       //texture
-     0.25f, -0.25f, 0.0f, //position
-     1.0f,  0.0f, 1.0f, //color
-     0.0f,  0.0f, 1.0f, //normal
-     0.0f,  0.0f,       //texture
-     0.25f,  0.25f, 0.0f, //position
-     0.0f,  1.0f, 0.0f, //color
-     0.0f,  0.0f, 1.0f, //normal
-     0.0f,  1.0f,       //texture
-    -0.25f,  0.25f, 0.0f, //position
-     1.0f,  1.0f, 1.0f, //color
-     0.0f,  0.0f, 1.0f, //normal
-     1.0f,  1.0f        //texture
-};
-GLuint indices[] = {
-    0, 1, 2,
-    0, 2, 3
-};
-
-void application::errorCallback(int code, const char* msg) {
-    _log.error("GLFW Error {}:\n{}\n", code, msg);
-}
-
-void application::framebufferSizeCallback(GLFWwindow* window, int width, int height) {
-    glViewport(0, 0, width, height);
-}
-
-void application::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
-    input::onKeyEvent(key, action);
-}
-
-void application::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
-    input::onMouseButtonEvent(button, action);
-}
-
-void application::mouseMoveCallback(GLFWwindow* window, double x, double y) {
-    input::onMouseMoveEvent(x, y);
-}
-
-void application::mouseWheelCallback(GLFWwindow* window, double xOffset, double yOffset) {
-    input::onMouseWheelEvent(yOffset);
-}
-
-void application::setWindowHints() {
-    // window hints
-    // https://www.glfw.org/docs/latest/window.html#window_hints
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
-    glfwWindowHint(GLFW_MAXIMIZED, GLFW_TRUE);
-#ifdef __APPLE__
-    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-#endif
-}
-
-void application::init() {
-    _currentTime = glfwGetTime();
-    _log.init();
-    glfwSetErrorCallback(errorCallback);
-    // Initialize the library
-    if (!glfwInit()) {
-        _log.error("Failed to initialize GLFW!");
-    }
-    setWindowHints();
-    // Create a windowed mode window and its OpenGL context
-    _window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Sketch Engine", nullptr, nullptr);
-    if (_window == nullptr) {
-        glfwTerminate();
-        _log.error("Failed to create GLFW window");
-    }
-    // Make the window's context current
-    glfwMakeContextCurrent(_window);
-
-    //Set VSync
-    glfwSwapInterval(1);
-
-    // Set callbacks for the window
-    glfwSetKeyCallback(_window, keyCallback);
-    glfwSetMouseButtonCallback(_window, mouseButtonCallback);
-    glfwSetCursorPosCallback(_window, mouseMoveCallback);
-    glfwSetScrollCallback(_window, mouseWheelCallback);
-    glfwSetFramebufferSizeCallback(_window, framebufferSizeCallback);
-
-    // Load GLAD
-    if(!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))){
-        _log.error("Failed to initialize GLAD");
-    }
-
-    _shaderProgram = std::make_unique<shader>("../src/rendering/shaders/triangle.vert", "../src/rendering/shaders/triangle.frag");
-    _texture = std::make_unique<texture>();
-    _texture->loadFromSTB("../src/assets/test.png");
-
-    _model = Mat4::translation({0.0f, 0.0f, 0.0f });
-    _view = Mat4::lookAt({0, 0, -5}, {0, 0, 0});
-    _projection = Mat4::perspective(60.0f, ASPECT_RATIO, 0.1f, 100.0f);
-
-    _vbo = std::make_unique<vbo>(vertices, sizeof(vertices));
-    _ebo = std::make_unique<ebo>(indices, sizeof(indices));
-    _vao = std::make_unique<vao>(*_vbo, *_ebo);
-    _texture->bind();
-    _renderer = new renderer(*_shaderProgram, *_vao, *_texture);
-}
-
-void application::run() {
-    while (!glfwWindowShouldClose(_window)) {
-        _currentTime = glfwGetTime();
-        const timestep deltaTime = _currentTime - _lastFrameTime;
-        _lastFrameTime = _currentTime;
-
-        // Render loop
-        _renderer->render(_model, _view, _projection);
-        glfwSwapBuffers(_window);
-        glfwPollEvents();
-        if (input::getKey(key.escape)) {
-            glfwSetWindowShouldClose(_window, GLFW_TRUE);
-        }
-        input::update(deltaTime);
-    }
-}
-
-void application::cleanup() const {
-    delete _renderer;
-    glfwDestroyWindow(_window);
-    glfwTerminate();
-}
-
-void application::start() {
-    init();
-    run();
-    cleanup();
-}
-
+#include "application.h"
+#include <cstdlib>
+#include <thread>
+
+constexpr float vertices[] = {
+    -0.25f, -0.25f, 0.0f, //position
+     0.0f,  0.0f, 0.0f, //color
+     0.0f,  0.0f, 1.0f, //normal
+     1.0f,  0.0f,       //texture
+     0.25f, -0.25f, 0.0f, //position
+     1.0f,  0.0f, 1.0f, //color
+     0.0f,  0.0f, 1.0f, //normal
+     0.0f,  0.0f,       //texture
+     0.25f,  0.25f, 0.0f, //position
+     0.0f,  1.0f, 0.0f, //color
+     0.0f,  0.0f, 1.0f, //normal
+     0.0f,  1.0f,       //texture
+    -0.25f,  0.25f, 0.0f, //position
+     1.0f,  1.0f, 1.0f, //color
+     0.0f,  0.0f, 1.0f, //normal
+     1.0f,  1.0f        //texture
+};
+GLuint indices[] = {
+    0, 1, 2,
+    0, 2, 3
+};
+
+applicationSettings applicationSettings::fromArgs(const int argc, char** argv) {
+    applicationSettings settings;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        if (arg.starts_with("--record=")) {
+            settings.recordPath = arg.substr(9);
+        } else if (arg.starts_with("--replay=")) {
+            settings.replayPath = arg.substr(9);
+        } else if (arg.starts_with("--sim-hz=")) {
+            const double hz = std::strtod(std::string(arg.substr(9)).c_str(), nullptr);
+            if (hz > 0.0) settings.simulationHz = hz;
+        } else if (arg.starts_with("--fps=")) {
+            settings.pacing.targetFps = std::strtod(std::string(arg.substr(6)).c_str(), nullptr);
+        } else if (arg.starts_with("--vsync=")) {
+            const std::string_view mode = arg.substr(8);
+            settings.pacing.swapInterval = mode == "off" ? 0 : mode == "adaptive" ? -1 : 1;
+        } else if (arg.starts_with("--frames-ahead=")) {
+            settings.pacing.maxFramesAhead = std::atoi(std::string(arg.substr(15)).c_str());
+        } else if (arg == "--threaded-render") {
+            settings.threadedRendering = true;
+        } else if (arg.starts_with("--snapshots=")) {
+            settings.snapshotBuffers = std::atoi(std::string(arg.substr(12)).c_str());
+        } else if (arg.starts_with("--entities=")) {
+            const long long count = std::atoll(std::string(arg.substr(11)).c_str());
+            if (count > 0) settings.entityCount = static_cast<size_t>(count);
+        }
+    }
+    return settings;
+}
+
+void application::errorCallback(int code, const char* msg) {
+    _log.error("GLFW Error {}:\n{}\n", code, msg);
+}
+
+void application::framebufferSizeCallback(GLFWwindow* window, int width, int height) {
+    _pendingFramebuffer.store(static_cast<uint64_t>(width) << 32 | static_cast<uint32_t>(height), std::memory_order_relaxed);
+}
+
+void application::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    if (!_liveInput) return;
+    input::postEvent({ inputEventType::KEY, key, action, 0.0f, 0.0f, input::now() });
+}
+
+void application::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+    if (!_liveInput) return;
+    input::postEvent({ inputEventType::MOUSE_BUTTON, button, action, 0.0f, 0.0f, input::now() });
+}
+
+void application::mouseMoveCallback(GLFWwindow* window, double x, double y) {
+    if (!_liveInput) return;
+    input::postEvent({ inputEventType::MOUSE_MOVE, 0, 0, static_cast<float>(x), static_cast<float>(y), input::now() });
+}
+
+void application::mouseWheelCallback(GLFWwindow* window, double xOffset, double yOffset) {
+    if (!_liveInput) return;
+    input::postEvent({ inputEventType::MOUSE_WHEEL, 0, 0, 0.0f, static_cast<float>(yOffset), input::now() });
+}
+
+void application::setWindowHints() {
+    // window hints
+    // https://www.glfw.org/docs/latest/window.html#window_hints
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
+    glfwWindowHint(GLFW_MAXIMIZED, GLFW_TRUE);
+#ifdef __APPLE__
+    glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+}
+
+void application::init() {
+    _lastFrameTicks = engineClock::now();
+    // console and file I/O happen on the logging thread so the render loop never blocks on them
+    logBackend::addSink(std::make_shared<fileSink>("sketch.log"));
+    logBackend::installCrashHandler();
+    logBackend::startAsync();
+    _log.init();
+    // generous on purpose, the warnings are there to catch regressions rather than to enforce a target
+    memoryTracker::setBudget(MemoryTag::RENDER, 64ll << 20, 256ll << 20);
+    memoryTracker::setBudget(MemoryTag::TEXTURE, 64ll << 20, 512ll << 20);
+    memoryTracker::setBudget(MemoryTag::LOGGING, 8ll << 20, 0);
+    memoryTracker::setBudget(MemoryTag::ASSETS, 32ll << 20, 0);
+    memoryTracker::setBudget(MemoryTag::SCENE, 128ll << 20, 0);
+    glfwSetErrorCallback(errorCallback);
+    // Initialize the library
+    if (!glfwInit()) {
+        _log.error("Failed to initialize GLFW!");
+    }
+    setWindowHints();
+    // Create a windowed mode window and its OpenGL context
+    _window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Sketch Engine", nullptr, nullptr);
+    if (_window == nullptr) {
+        glfwTerminate();
+        _log.error("Failed to create GLFW window");
+    }
+    // Make the window's context current
+    glfwMakeContextCurrent(_window);
+
+    // Set callbacks for the window
+    glfwSetKeyCallback(_window, keyCallback);
+    glfwSetMouseButtonCallback(_window, mouseButtonCallback);
+    glfwSetCursorPosCallback(_window, mouseMoveCallback);
+    glfwSetScrollCallback(_window, mouseWheelCallback);
+    glfwSetFramebufferSizeCallback(_window, framebufferSizeCallback);
+
+    // Load GLAD
+    if(!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))){
+        _log.error("Failed to initialize GLAD");
+    }
+    _pacer.init(_window, _settings.pacing);
+    // started once the window exists so the common startup failures exit before any worker is running
+    jobSystem::init();
+
+    _shaderProgram = gpuResources::shaders().create("../src/rendering/shaders/triangle.vert", "../src/rendering/shaders/triangle.frag");
+    _texture = gpuResources::textures().create();
+    gpuResources::textures().get(_texture)->loadFromSTB("../src/assets/test.png");
+
+    _simulation = fixedTimestep(_settings.simulationHz, _settings.maxSimulationSteps);
+
+    _vbo = gpuResources::vbos().create(vertices, sizeof(vertices));
+    _ebo = gpuResources::ebos().create(indices, sizeof(indices));
+    _vao = gpuResources::vaos().create(_vbo, _ebo);
+    const vbo* quad = gpuResources::vbos().get(_vbo);
+    _scene.setCamera(Mat4::lookAt({0, 0, -5}, {0, 0, 0}), Mat4::perspective(60.0f, ASPECT_RATIO, 0.1f, 100.0f));
+    _scene.init(_settings.entityCount, quad->getBoundsMin(), quad->getBoundsMax());
+    {
+        memoryScope scope(MemoryTag::RENDER);
+        _renderer = new renderer(_shaderProgram, _vao, _texture);
+    }
+
+    if (!_settings.replayPath.empty()) {
+        _liveInput = !_replay.open(_settings.replayPath);
+    } else if (!_settings.recordPath.empty()) {
+        _recorder.start(_settings.recordPath);
+    }
+}
+
+void application::run() {
+    if (!_settings.threadedRendering) {
+        SKETCH_PROFILE_THREAD("main");
+        while (!glfwWindowShouldClose(_window)) {
+            {
+                SKETCH_PROFILE_SCOPE("events");
+                glfwPollEvents();
+            }
+            frame();
+        }
+        return;
+    }
+
+    // the render thread only draws snapshots, the main thread pumps events and simulates the next frame
+    // while the current one is submitted, the queue keeps the simulation at most a slot or two ahead
+    _snapshots.setSlotCount(static_cast<size_t>(_settings.snapshotBuffers));
+    _log.info("Rendering on a dedicated thread with {} snapshot buffers", _settings.snapshotBuffers);
+    glfwMakeContextCurrent(nullptr);
+    std::thread renderThread([this] {
+        SKETCH_PROFILE_THREAD("render");
+        jobSystem::registerThread();
+        glfwMakeContextCurrent(_window);
+        while (const frameSnapshot* snapshot = _snapshots.consume()) {
+            SKETCH_PROFILE_FRAME();
+            SKETCH_PROFILE_SCOPE("frame");
+            {
+                SKETCH_PROFILE_SCOPE("gpu wait");
+                _pacer.beginFrame();
+            }
+            draw(*snapshot);
+        }
+        glfwMakeContextCurrent(nullptr);
+    });
+    SKETCH_PROFILE_THREAD("main");
+    while (!glfwWindowShouldClose(_window)) {
+        {
+            SKETCH_PROFILE_SCOPE("events");
+            glfwPollEvents();
+        }
+        update(_snapshots.acquire());
+        _snapshots.publish();
+    }
+    _snapshots.close();
+    renderThread.join();
+    // cleanup releases GL objects on this thread
+    glfwMakeContextCurrent(_window);
+}
+
+// one single threaded frame, window events have already been pumped
+void application::frame() {
+    SKETCH_PROFILE_FRAME();
+    SKETCH_PROFILE_SCOPE("frame");
+    {
+        SKETCH_PROFILE_SCOPE("gpu wait");
+        _pacer.beginFrame();
+    }
+    update(_snapshot);
+    draw(_snapshot);
+}
+
+// input and simulation, ends by writing everything the renderer needs into the snapshot
+void application::update(frameSnapshot& snapshot) {
+    SKETCH_PROFILE_FUNCTION();
+    const int64_t now = engineClock::now();
+    timestep deltaTime = timestep::fromTicks(now - _lastFrameTicks);
+    _lastFrameTicks = now;
+
+    input::processPostedEvents();
+    // replays advance each frame by the delta it was recorded with so every run simulates the same frames
+    if (_replay.isPlaying()) {
+        deltaTime = _replay.feed(_frame);
+    } else {
+        _recorder.record(_frame, deltaTime);
+    }
+    if (input::getKey(key.escape)) {
+        requestClose();
+    }
+    snapshot.logGpuReport = input::getKeyDown(key.f1);
+    snapshot.toggleStatsOverlay = input::getKeyDown(key.f3);
+    snapshot.logMemoryReport = input::getKeyDown(key.f4);
+    if (input::getKeyDown(key.p)) {
+        _gameClock.setPaused(!_gameClock.isPaused());
+    }
+    if (input::getKeyDown(key.f2)) {
+        // toggle a capture, the trace is written when it stops
+        const bool capturing = !cpuProfiler::isEnabled();
+        cpuProfiler::setEnabled(capturing);
+        if (!capturing) {
+            cpuProfiler::writeChromeTrace("sketch_trace.json");
+        }
+    }
+
+    {
+        SKETCH_PROFILE_SCOPE("simulation");
+        const int steps = _simulation.advance(_gameClock.advance(deltaTime));
+        for (int i = 0; i < steps; i++) {
+            _scene.fixedUpdate(_simulation.getStep());
+        }
+    }
+
+    // drawn between the last two simulation states so motion stays smooth at any display rate
+    _scene.extract(_simulation.getAlpha(), snapshot);
+    snapshot.frame = _frame;
+
+    input::update(deltaTime);
+    _frame++;
+    if (_replay.isPlaying() && _replay.finished(_frame)) {
+        requestClose();
+    }
+}
+
+// everything that touches GL, runs on the thread that owns the context
+void application::draw(const frameSnapshot& snapshot) {
+    SKETCH_PROFILE_FUNCTION();
+    if (const uint64_t framebuffer = _pendingFramebuffer.exchange(0, std::memory_order_relaxed)) {
+        glViewport(0, 0, static_cast<GLsizei>(framebuffer >> 32), static_cast<GLsizei>(framebuffer & 0xFFFFFFFF));
+    }
+    if (snapshot.logGpuReport) {
+        _renderer->getGpuProfiler().logReport();
+    }
+    if (snapshot.toggleStatsOverlay) {
+        _renderer->toggleStatsOverlay();
+    }
+    if (snapshot.logMemoryReport) {
+        memoryTracker::logReport();
+    }
+    _renderer->render(snapshot.models, snapshot.objectIds, snapshot.view, snapshot.projection);
+    {
+        SKETCH_PROFILE_SCOPE("swap");
+        glfwSwapBuffers(_window);
+    }
+    {
+        SKETCH_PROFILE_SCOPE("pacing");
+        _pacer.endFrame();
+    }
+    frameStats::endFrame();
+}
+
+// called from update on the main thread, which polls rather than waits, so the loop sees it next frame
+void application::requestClose() const {
+    glfwSetWindowShouldClose(_window, GLFW_TRUE);
+}
+
+void application::cleanup() {
+    // frame stats belong to the render thread, the summary is only read once it has stopped
+    if (_replay.isPlaying() && _replay.finished(_frame)) {
+        const frameSummary& summary = frameStats::getSummary();
+        _log.info("Replay finished after {} frames, p50 {:.2f} ms  p95 {:.2f} ms  p99 {:.2f} ms",
+                  _frame, summary.p50Ms, summary.p95Ms, summary.p99Ms);
+    }
+    _recorder.stop(_frame);
+    _pacer.release();
+    delete _renderer;
+    gpuResources::clear();
+    glfwDestroyWindow(_window);
+    glfwTerminate();
+    jobSystem::shutdown();
+    logBackend::stopAsync();
+}
+
+void application::start() {
+    init();
+    run();
+    cleanup();
+}
+
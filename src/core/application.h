@@ -1,52 +1,89 @@
-#pragma once
-#define GLFW_INCLUDE_NONE
-#include <GLFW/glfw3.h>
-#include <glad/glad.h>
-#include "rendering/renderer.h"
-#include "math/math.h"
-#include "logging/logger.h"
-#include "rendering/shaders/shader.h"
-#include "rendering/vao.h"
-#include "rendering/vbo.h"
-#include "rendering/ebo.h"
-#include "utils/texture.h"
-#include "timestep.h"
-#include "input/input.h"
-#include "input/keycodes.h"
-#include "input/mousecodes.h"
-
-class application {
-public:
-    void start();
-private:
-    void init();
-    void run();
-    void cleanup() const;
-    static void errorCallback(int code, const char* msg);
-    static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
-    static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
-    static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
-    static void mouseMoveCallback(GLFWwindow* window, double x, double y);
-    static void mouseWheelCallback(GLFWwindow* window, double xOffset, double yOffset);
-    static void setWindowHints();
-
-    GLFWwindow* _window = nullptr;
-    renderer* _renderer = nullptr;
-    static inline logger _log;
-
-    static constexpr GLuint SCREEN_WIDTH = 3840;
-    static constexpr GLuint SCREEN_HEIGHT = 2160;
-    static constexpr GLfloat ASPECT_RATIO = 16.0f / 9.0f;
-    float _currentTime = 0;
-    float _lastFrameTime = 0;
-
-    Mat4 _model;
-    Mat4 _view;
-    Mat4 _projection;
-
-    std::unique_ptr<vao> _vao;
-    std::unique_ptr<vbo> _vbo;
-    std::unique_ptr<ebo> _ebo;
-    std::unique_ptr<shader> _shaderProgram = nullptr;
-    std::unique_ptr<texture> _texture = nullptr;
-};
+#pragma once
+#define GLFW_INCLUDE_NONE
+#include <atomic>
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+#include "rendering/renderer.h"
+#include "math/math.h"
+#include "logging/logger.h"
+#include "logging/fileSink.h"
+#include "rendering/gpuResources.h"
+#include "timestep.h"
+#include "fixedTimestep.h"
+#include "engineClock.h"
+#include "framePacer.h"
+#include "jobSystem.h"
+#include "frameSnapshot.h"
+#include "ecs/scene.h"
+#include "input/input.h"
+#include "input/keycodes.h"
+#include "input/mousecodes.h"
+#include "input/inputRecorder.h"
+#include "profiling/cpuProfiler.h"
+#include "profiling/frameStats.h"
+#include "profiling/memoryTracker.h"
+
+// options read from the command line
+struct applicationSettings {
+    std::string recordPath;  //--record=<file> writes the session's input for later replay
+    std::string replayPath;  //--replay=<file> plays a recording back on a fixed timestep and exits when it ends
+    double simulationHz = 60.0;      //--sim-hz=<rate> fixed update rate, independent of the display rate
+    int maxSimulationSteps = 5;      //catch-up steps per frame before the backlog is dropped
+    framePacerSettings pacing;       //--fps=<rate> --vsync=off|on|adaptive --frames-ahead=<count>
+    bool threadedRendering = false;  //--threaded-render draws on a render thread while the main thread pumps events and simulates
+    int snapshotBuffers = 2;         //--snapshots=2|3 frames in flight between the simulation and the render thread
+    size_t entityCount = 1000;       //--entities=<count> objects in the scene, the first one is the player
+
+    static applicationSettings fromArgs(int argc, char** argv);
+};
+
+class application {
+public:
+    explicit application(applicationSettings settings = {}) : _settings(std::move(settings)) {}
+    void start();
+private:
+    void init();
+    void run();
+    void frame();
+    void update(frameSnapshot& snapshot);
+    void draw(const frameSnapshot& snapshot);
+    void requestClose() const;
+    void cleanup();
+    static void errorCallback(int code, const char* msg);
+    static void framebufferSizeCallback(GLFWwindow* window, int width, int height);
+    static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void mouseMoveCallback(GLFWwindow* window, double x, double y);
+    static void mouseWheelCallback(GLFWwindow* window, double xOffset, double yOffset);
+    static void setWindowHints();
+
+    applicationSettings _settings;
+    GLFWwindow* _window = nullptr;
+    renderer* _renderer = nullptr;
+    static inline logger<LogCategory::CORE> _log;
+
+    static constexpr GLuint SCREEN_WIDTH = 3840;
+    static constexpr GLuint SCREEN_HEIGHT = 2160;
+    static constexpr GLfloat ASPECT_RATIO = 16.0f / 9.0f;
+    int64_t _lastFrameTicks = 0;
+    scaledClock _gameClock;  //pausable, drives the simulation while real time keeps driving input and rendering
+    uint32_t _frame = 0;
+
+    inputRecorder _recorder;
+    inputReplay _replay;
+    static inline bool _liveInput = true;  //off while replaying so the real mouse and keyboard do not interfere
+    static inline std::atomic<uint64_t> _pendingFramebuffer = 0;  //width << 32 | height, applied on the thread that owns the context
+
+    framePacer _pacer;
+    fixedTimestep _simulation;
+    scene _scene;
+
+    frameSnapshot _snapshot;   //single threaded frames build and draw this one
+    snapshotQueue _snapshots;  //threaded rendering hands frames over through this
+
+    vaoHandle _vao;
+    vboHandle _vbo;
+    eboHandle _ebo;
+    shaderHandle _shaderProgram;
+    textureHandle _texture;
+};
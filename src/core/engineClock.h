@@ -0,0 +1,50 @@
+#pragma once
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include "timestep.h"
+#include "logging/logBackend.h"
+
+// ENGINE CLOCK - monotonic time as 64-bit nanosecond ticks since startup, precision does not degrade with uptime
+// shares its epoch with the profiler, the input event timestamps and monotonic log timestamps
+class engineClock {
+public:
+    [[nodiscard]] static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - logBackend::epoch()).count();
+    }
+    [[nodiscard]] static double seconds() { return static_cast<double>(now()) / timestep::TICKS_PER_SECOND; }
+};
+
+// SCALED CLOCK - time that can be paused or run slower or faster than the delta it is fed
+// sub-clocks are advanced with the delta their parent returned, so pausing a parent stops everything below it
+class scaledClock {
+public:
+    // converts the parent's delta into this clock's delta and accumulates it
+    timestep advance(const timestep parentDelta) {
+        const timestep scaled = scale(parentDelta);
+        _ticks += scaled.getTicks();
+        return scaled;
+    }
+
+    void setPaused(const bool paused) { _paused = paused; }
+    void setScale(const double scale) { _scale = scale > 0.0 ? scale : 0.0; }
+    [[nodiscard]] bool isPaused() const { return _paused; }
+    [[nodiscard]] double getScale() const { return _scale; }
+    [[nodiscard]] int64_t getTicks() const { return _ticks; }
+    [[nodiscard]] double getSeconds() const { return static_cast<double>(_ticks) / timestep::TICKS_PER_SECOND; }
+private:
+    // sub-tick remainders are carried so a scaled clock does not drift from scale * real time
+    timestep scale(const timestep delta) {
+        if (_paused) return {};
+        if (_scale == 1.0) return delta;
+        const double scaled = static_cast<double>(delta.getTicks()) * _scale + _remainder;
+        const double whole = std::floor(scaled);
+        _remainder = scaled - whole;
+        return timestep::fromTicks(static_cast<int64_t>(whole));
+    }
+
+    bool _paused = false;
+    double _scale = 1.0;
+    double _remainder = 0.0;
+    int64_t _ticks = 0;
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include "timestep.h"
+
+// FIXED TIMESTEP - banks real frame time and pays it out in equal simulation steps so simulation results and cost
+// do not depend on the display rate, the fraction of a step left over is the alpha rendering interpolates with
+// time is kept in integer ticks so the accumulator never drifts however long the engine runs
+class fixedTimestep {
+public:
+    explicit fixedTimestep(const double hz = 60.0, const int maxSteps = 5) : _maxSteps(maxSteps) { setRate(hz); }
+
+    void setRate(const double hz) { _step = timestep(1.0 / hz); }
+    void setMaxSteps(const int maxSteps) { _maxSteps = maxSteps; }
+
+    // steps to simulate this frame, a backlog beyond maxSteps is dropped so one slow frame cannot snowball
+    int advance(const timestep frameTime) {
+        _accumulator += frameTime.getTicks() > 0 ? frameTime.getTicks() : 0;
+        int64_t steps = _accumulator / _step.getTicks();
+        if (steps > _maxSteps) {
+            _droppedSteps += static_cast<uint64_t>(steps - _maxSteps);
+            steps = _maxSteps;
+        }
+        _accumulator -= steps * _step.getTicks();
+        _accumulator %= _step.getTicks();
+        _stepCount += static_cast<uint64_t>(steps);
+        return static_cast<int>(steps);
+    }
+
+    [[nodiscard]] timestep getStep() const { return _step; }
+    // 0 renders the previous simulation state, 1 the current one
+    [[nodiscard]] float getAlpha() const { return static_cast<float>(static_cast<double>(_accumulator) / static_cast<double>(_step.getTicks())); }
+    [[nodiscard]] uint64_t getStepCount() const { return _stepCount; }
+    [[nodiscard]] uint64_t getDroppedSteps() const { return _droppedSteps; }
+private:
+    timestep _step;
+    int64_t _accumulator = 0;
+    int _maxSteps = 5;
+    uint64_t _stepCount = 0;
+    uint64_t _droppedSteps = 0;
+};
@@ -0,0 +1,75 @@
+#include "frameArena.h"
+#include <algorithm>
+#include <cstdint>
+#include "jobSystem.h"
+
+void* linearArena::do_allocate(const size_t bytes, const size_t alignment) {
+    while (true) {
+        if (_current < _blocks.size()) {
+            block& current = _blocks[_current];
+            const auto base = reinterpret_cast<uintptr_t>(current.data.get());
+            const size_t aligned = ((base + _offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base;
+            if (aligned + bytes <= current.size) {
+                _offset = aligned + bytes;
+                _used += bytes;
+                return current.data.get() + aligned;
+            }
+            // the tail of this block is wasted until the next reset
+            _current++;
+            _offset = 0;
+            continue;
+        }
+        const size_t size = std::max(_blockSize, bytes + alignment);
+        memoryScope scope(_tag);
+        _blocks.push_back({ std::make_unique_for_overwrite<std::byte[]>(size), size });
+        _capacity += size;
+    }
+}
+
+void linearArena::reset() {
+    _peak = std::max(_peak, _used);
+    // a frame that spilled into several blocks is merged into one so the next frame stays in a single block
+    if (_current > 0 && _blocks.size() > 1) {
+        _blockSize = std::max(_blockSize, _capacity);
+        _blocks.clear();
+        _capacity = 0;
+    }
+    _current = 0;
+    _offset = 0;
+    _used = 0;
+}
+
+void frameArena::begin() {
+    const size_t count = jobSystem::getThreadCount() + 1;
+    while (_arenas.size() < count) {
+        _arenas.push_back(std::make_unique<linearArena>(linearArena::DEFAULT_BLOCK_SIZE, _tag));
+    }
+}
+
+void frameArena::reset() {
+    for (const auto& arena : _arenas) {
+        arena->reset();
+    }
+}
+
+// the last arena is shared by unregistered threads, job threads beyond the current count fall back to it too
+linearArena& frameArena::local() {
+    const int index = jobSystem::getThreadIndex();
+    return index >= 0 && static_cast<size_t>(index) + 1 < _arenas.size() ? *_arenas[index] : *_arenas.back();
+}
+
+size_t frameArena::getUsedBytes() const {
+    size_t used = 0;
+    for (const auto& arena : _arenas) {
+        used += arena->getUsedBytes();
+    }
+    return used;
+}
+
+size_t frameArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const auto& arena : _arenas) {
+        capacity += arena->getCapacity();
+    }
+    return capacity;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include "profiling/memoryTracker.h"
+
+// LINEAR ARENA - bump allocator over a list of blocks, frees are no-ops and reset rewinds everything at once
+// blocks are kept across resets so once the arena has grown to a frame's peak it stops calling new entirely
+// derives from std::pmr::memory_resource so pmr containers can allocate from it directly
+class alignas(64) linearArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    // blocks are charged to tag whichever thread happens to grow the arena
+    explicit linearArena(size_t blockSize = DEFAULT_BLOCK_SIZE, MemoryTag tag = MemoryTag::UNTAGGED) : _blockSize(blockSize), _tag(tag) {}
+    linearArena(const linearArena&) = delete;
+    linearArena& operator=(const linearArena&) = delete;
+
+    // everything allocated since the last reset is invalid afterwards
+    void reset();
+
+    [[nodiscard]] size_t getUsedBytes() const { return _used; }
+    [[nodiscard]] size_t getPeakBytes() const { return _peak; }
+    [[nodiscard]] size_t getCapacity() const { return _capacity; }
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+private:
+    struct block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size = 0;
+    };
+
+    std::vector<block> _blocks;
+    size_t _blockSize;
+    MemoryTag _tag;
+    size_t _current = 0;  //block being bumped
+    size_t _offset = 0;   //first free byte in it
+    size_t _used = 0;
+    size_t _peak = 0;
+    size_t _capacity = 0;
+};
+
+// FRAME ARENA - one linear arena per job system thread so recording jobs allocate without locking,
+// memory lives until reset at the end of the frame
+class frameArena {
+public:
+    explicit frameArena(const MemoryTag tag = MemoryTag::UNTAGGED) : _tag(tag) {}
+
+    // sizes the sub-arenas to the job system, call on the owning thread before any job allocates
+    // arenas are only ever added so resources handed out earlier stay valid for the frame arena's lifetime
+    void begin();
+    // rewinds every sub-arena, call once nothing allocated this frame is used anymore
+    void reset();
+
+    // the calling thread's arena, unregistered threads share the last one and must not allocate concurrently
+    [[nodiscard]] linearArena& local();
+    [[nodiscard]] linearArena& at(size_t index) { return *_arenas[index]; }
+    [[nodiscard]] size_t getCount() const { return _arenas.size(); }
+    [[nodiscard]] size_t getUsedBytes() const;
+    [[nodiscard]] size_t getCapacity() const;
+private:
+    std::vector<std::unique_ptr<linearArena>> _arenas;
+    MemoryTag _tag;
+};
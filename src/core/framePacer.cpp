@@ -0,0 +1,94 @@
+#include "framePacer.h"
+#include <algorithm>
+#include <thread>
+#include "engineClock.h"
+
+void framePacer::init(GLFWwindow* window, const framePacerSettings& settings) {
+    _settings = settings;
+    _settings.maxFramesAhead = std::clamp(_settings.maxFramesAhead, 0, MAX_FRAMES_AHEAD);
+    _swapInterval = _settings.swapInterval;
+    if (_swapInterval < 0 && !glfwExtensionSupported("WGL_EXT_swap_control_tear") && !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+        _log.warn("Adaptive vsync is not supported, falling back to vsync");
+        _swapInterval = 1;
+    }
+    glfwSwapInterval(_swapInterval);
+
+    GLFWmonitor* monitor = glfwGetWindowMonitor(window);
+    const GLFWvidmode* mode = glfwGetVideoMode(monitor ? monitor : glfwGetPrimaryMonitor());
+    _refreshPeriod = mode && mode->refreshRate > 0 ? timestep::TICKS_PER_SECOND / mode->refreshRate : 0;
+    setTargetFps(_settings.targetFps);
+    _lastFrameEnd = _reportStart = engineClock::now();
+    _log.info("Frame pacing: swap interval {}, target {} fps, {} frames ahead", _swapInterval, _settings.targetFps, _settings.maxFramesAhead);
+}
+
+void framePacer::setTargetFps(const double fps) {
+    _settings.targetFps = fps;
+    _period = fps > 0.0 ? static_cast<int64_t>(timestep::TICKS_PER_SECOND / fps) : 0;
+    _nextDeadline = engineClock::now() + _period;
+}
+
+void framePacer::beginFrame() {
+    if (_settings.maxFramesAhead == 0) return;
+    GLsync& fence = _fences[_frame % _settings.maxFramesAhead];
+    if (fence) {
+        // a generous timeout so a hung driver shows up as a stall instead of a deadlock
+        glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000);
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
+void framePacer::endFrame() {
+    if (_settings.maxFramesAhead > 0) {
+        _fences[_frame % _settings.maxFramesAhead] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    _frame++;
+
+    int64_t now = engineClock::now();
+    if (_period > 0) {
+        if (now < _nextDeadline) {
+            waitUntil(_nextDeadline);
+            now = engineClock::now();
+            _nextDeadline += _period;
+        } else {
+            // already late, schedule from now instead of rushing the following frames to catch up
+            _nextDeadline = now + _period;
+        }
+    }
+
+    // a frame counts as missed when it took half a period longer than it should have
+    const int64_t expected = _period > 0 ? _period : (_swapInterval != 0 ? _refreshPeriod : 0);
+    if (expected > 0 && now - _lastFrameEnd > expected + expected / 2) {
+        _missedDeadlines++;
+        _missedThisSecond++;
+    }
+    _lastFrameEnd = now;
+
+    if (now - _reportStart >= timestep::TICKS_PER_SECOND) {
+        if (_missedThisSecond) {
+            _log.warn("Missed {} frame deadlines in the last second ({} total)", _missedThisSecond, _missedDeadlines);
+        }
+        _missedThisSecond = 0;
+        _reportStart = now;
+    }
+}
+
+void framePacer::waitUntil(const int64_t deadline) const {
+    const int64_t spin = _settings.spinMicroseconds * 1000;
+    const int64_t sleepFor = deadline - spin - engineClock::now();
+    if (sleepFor > 0) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(sleepFor));
+    }
+    while (engineClock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void framePacer::release() {
+    for (GLsync& fence : _fences) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include "logging/logger.h"
+
+struct framePacerSettings {
+    double targetFps = 0.0;         //0 leaves pacing to the swap interval
+    int swapInterval = 1;           //0 off, 1 vsync, -1 adaptive (tears instead of stalling on a missed vblank)
+    int maxFramesAhead = 2;         //frames the CPU may queue ahead of the GPU, 0 disables the fence limit
+    int64_t spinMicroseconds = 2000;  //the last stretch before a deadline is spun instead of slept, sleep wakes up late
+};
+
+// FRAME PACER - keeps frame times even rather than maximal: waits out a target frame time (sleep then spin),
+// picks adaptive vsync when the driver has it, bounds how far the CPU runs ahead of the GPU with fences
+// and counts frames that missed their deadline
+class framePacer {
+public:
+    static constexpr int MAX_FRAMES_AHEAD = 4;
+
+    // needs the window's context current, sets the swap interval
+    void init(GLFWwindow* window, const framePacerSettings& settings);
+    // blocks until the GPU has finished the frame maxFramesAhead frames back
+    void beginFrame();
+    // call after swapping, fences the frame and waits out the rest of the target frame time
+    void endFrame();
+    void setTargetFps(double fps);
+    // deletes outstanding fences, call while the context is still current
+    void release();
+
+    [[nodiscard]] uint64_t getMissedDeadlines() const { return _missedDeadlines; }
+    [[nodiscard]] int getSwapInterval() const { return _swapInterval; }
+private:
+    void waitUntil(int64_t deadline) const;
+
+    framePacerSettings _settings;
+    int _swapInterval = 1;
+    int64_t _period = 0;          //ticks per frame at the target rate, 0 when unpaced
+    int64_t _refreshPeriod = 0;   //ticks per display refresh, used to judge missed vblanks
+    int64_t _nextDeadline = 0;
+    int64_t _lastFrameEnd = 0;
+    GLsync _fences[MAX_FRAMES_AHEAD] = {};
+    uint64_t _frame = 0;
+
+    uint64_t _missedDeadlines = 0;
+    uint64_t _missedThisSecond = 0;
+    int64_t _reportStart = 0;
+    static inline logger<LogCategory::CORE> _log;
+};
@@ -0,0 +1,44 @@
+#include "frameSnapshot.h"
+#include <algorithm>
+#include "profiling/cpuProfiler.h"
+
+void snapshotQueue::setSlotCount(const size_t slots) {
+    _slotCount = std::clamp<size_t>(slots, 2, MAX_SLOTS);
+}
+
+frameSnapshot& snapshotQueue::acquire() {
+    SKETCH_PROFILE_FUNCTION();
+    std::unique_lock lock(_mutex);
+    _changed.wait(lock, [this] { return slotsInUse() < _slotCount; });
+    return _slots[_published % _slotCount];
+}
+
+void snapshotQueue::publish() {
+    {
+        std::lock_guard lock(_mutex);
+        _published++;
+    }
+    _changed.notify_all();
+}
+
+void snapshotQueue::close() {
+    {
+        std::lock_guard lock(_mutex);
+        _closed = true;
+    }
+    _changed.notify_all();
+}
+
+const frameSnapshot* snapshotQueue::consume() {
+    SKETCH_PROFILE_FUNCTION();
+    const frameSnapshot* next = nullptr;
+    {
+        std::unique_lock lock(_mutex);
+        _changed.wait(lock, [this] { return _consumed < _published || _closed; });
+        if (_consumed == _published) return nullptr;
+        next = &_slots[_consumed++ % _slotCount];
+    }
+    // taking the next snapshot released the previous one
+    _changed.notify_all();
+    return next;
+}
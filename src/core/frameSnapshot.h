@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "math/math.h"
+
+// everything the renderer needs for one frame, built by the simulation and never modified once published
+struct frameSnapshot {
+    std::vector<Mat4> models;          //one transform per drawn object, the vector is reused so steady frames do not allocate
+    std::vector<uint32_t> objectIds;   //stable id per model so per object GPU state follows it across frames, empty uses the index
+    Mat4 view;
+    Mat4 projection;
+    uint32_t frame = 0;
+    bool toggleStatsOverlay = false;   //one shot requests, they only apply to the frame they arrive with
+    bool logGpuReport = false;
+    bool logMemoryReport = false;      //read on the render thread, which also closes the memory tracker's frames
+};
+
+// SNAPSHOT QUEUE - hands snapshots from the simulation thread to the render thread in order, with two slots the
+// simulation builds frame N+1 while frame N is drawn, a third lets it run one more frame ahead to absorb spikes
+class snapshotQueue {
+public:
+    static constexpr size_t MAX_SLOTS = 3;
+
+    explicit snapshotQueue(size_t slots = 2) { setSlotCount(slots); }
+    // call before either thread starts using the queue
+    void setSlotCount(size_t slots);
+
+    // producer - blocks until a slot is free, the slot still holds whatever was written to it last
+    [[nodiscard]] frameSnapshot& acquire();
+    void publish();
+    // wakes the consumer for the last time, snapshots already published are still drawn
+    void close();
+
+    // consumer - blocks until the next snapshot, the previous one is handed back to the producer
+    // returns nullptr once the queue is closed and drained
+    [[nodiscard]] const frameSnapshot* consume();
+private:
+    [[nodiscard]] size_t slotsInUse() const { return (_published - _consumed) + (_consumed > 0 ? 1 : 0); }
+
+    std::array<frameSnapshot, MAX_SLOTS> _slots;
+    size_t _slotCount = 2;
+    uint64_t _published = 0;  //snapshots published so far, the next one is written to _published % _slotCount
+    uint64_t _consumed = 0;   //snapshots taken by the consumer, it holds the last one until it takes another
+    bool _closed = false;
+    std::mutex _mutex;
+    std::condition_variable _changed;
+};
@@ -0,0 +1,149 @@
+#include "jobSystem.h"
+#include <chrono>
+#include "profiling/cpuProfiler.h"
+
+void jobSystem::init(unsigned workerCount) {
+    if (isRunning()) return;
+    if (workerCount == 0) {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 1;
+    }
+    _slotCount = workerCount + MAX_EXTERNAL_THREADS;
+    _slots = std::make_unique<threadSlot[]>(_slotCount);
+    for (size_t i = 0; i < _slotCount; i++) {
+        _slots[i].random = static_cast<uint32_t>(i * 2654435761u + 1);
+    }
+    _registeredSlots.store(workerCount, std::memory_order_relaxed);
+    _running.store(true, std::memory_order_release);
+    for (unsigned i = 0; i < workerCount; i++) {
+        _workers.emplace_back(workerLoop, static_cast<int>(i));
+    }
+    registerThread();
+    // a fatal error exits from wherever it happens, the workers have to be joined before that
+    logBackend::addFatalHook(&jobSystem::stopWorkers);
+    _log.info("Job system started with {} workers", workerCount);
+}
+
+void jobSystem::shutdown() {
+    stopWorkers();
+    _slot = -1;
+    _slots.reset();
+    _registeredSlots.store(0, std::memory_order_relaxed);
+}
+
+void jobSystem::stopWorkers() {
+    if (!_running.exchange(false, std::memory_order_acq_rel)) return;
+    {
+        std::lock_guard lock(_sleepMutex);
+        _wake.notify_all();
+    }
+    for (size_t i = 0; i < _workers.size(); i++) {
+        std::thread& worker = _workers[i];
+        // a worker failing fatally shuts down from its own thread, and cannot join itself
+        if (worker.get_id() == std::this_thread::get_id()) {
+            worker.detach();
+            continue;
+        }
+        // a worker that failed while another thread was already failing is parked for good, joining it would hang
+        while (!_slots[i].stopped.load(std::memory_order_acquire) && !logBackend::isParkedInFatal(worker.get_id())) {
+            std::this_thread::yield();
+        }
+        if (_slots[i].stopped.load(std::memory_order_acquire)) {
+            worker.join();
+        } else {
+            worker.detach();
+        }
+    }
+    _workers.clear();
+}
+
+bool jobSystem::registerThread() {
+    if (_slot >= 0) return true;
+    const size_t slot = _registeredSlots.fetch_add(1, std::memory_order_relaxed);
+    if (slot >= _slotCount) {
+        _log.warn("No job slots left, jobs from this thread will run inline");
+        return false;
+    }
+    _slot = static_cast<int>(slot);
+    return true;
+}
+
+void jobSystem::submit(threadSlot* slot, job* newJob) {
+    if (!slot->queue.push(newJob)) {
+        // the deque is full, running it here keeps the submitter making progress
+        execute(newJob);
+        return;
+    }
+    if (_sleeping.load(std::memory_order_relaxed)) {
+        _wake.notify_one();
+    }
+}
+
+// own work first, newest first for cache warmth, then steal the oldest work of a random victim
+job* jobSystem::findJob(threadSlot* slot) {
+    if (job* own = slot->queue.pop()) return own;
+    const size_t slots = std::min(_registeredSlots.load(std::memory_order_relaxed), _slotCount);
+    slot->random ^= slot->random << 13;
+    slot->random ^= slot->random >> 17;
+    slot->random ^= slot->random << 5;
+    for (size_t i = 0; i < slots; i++) {
+        threadSlot& victim = _slots[(slot->random + i) % slots];
+        if (&victim == slot) continue;
+        if (job* stolen = victim.queue.steal()) return stolen;
+    }
+    return nullptr;
+}
+
+void jobSystem::execute(job* current) {
+    if (current->dependency && !current->dependency->isDone()) {
+        // not ready yet, this thread helps with other work until it is, which also runs the jobs it depends on
+        wait(*current->dependency);
+        // stopped while waiting, the job is dropped rather than run before what it depends on
+        if (!current->dependency->isDone()) return;
+    }
+    jobCounter* counter = current->counter;
+    current->invoke(current->storage);
+    current->inFlight.store(false, std::memory_order_release);
+    if (counter) counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void jobSystem::helpOnce(threadSlot* slot) {
+    if (job* next = slot ? findJob(slot) : nullptr) {
+        execute(next);
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+void jobSystem::wait(const jobCounter& counter) {
+    threadSlot* slot = currentSlot();
+    // the jobs it waits for may never run once the workers are gone
+    while (!counter.isDone() && isRunning()) {
+        helpOnce(slot);
+    }
+}
+
+void jobSystem::workerLoop(const int slot) {
+    _slot = slot;
+    SKETCH_PROFILE_THREAD("job worker");
+    threadSlot* self = &_slots[slot];
+    uint32_t idle = 0;
+    while (isRunning()) {
+        if (job* next = findJob(self)) {
+            execute(next);
+            idle = 0;
+            continue;
+        }
+        if (++idle < 64) {
+            std::this_thread::yield();
+            continue;
+        }
+        // nothing to steal for a while, sleep until a submit wakes us or a short timeout passes
+        std::unique_lock lock(_sleepMutex);
+        _sleeping.fetch_add(1, std::memory_order_relaxed);
+        _wake.wait_for(lock, std::chrono::milliseconds(1));
+        _sleeping.fetch_sub(1, std::memory_order_relaxed);
+        idle = 0;
+    }
+    self->stopped.store(true, std::memory_order_release);
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "workStealingDeque.h"
+#include "logging/logger.h"
+
+// counts unfinished jobs, wait on it or hand it to run as a dependency
+struct jobCounter {
+    std::atomic<uint32_t> pending = 0;
+    [[nodiscard]] bool isDone() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+// a task stored inline so scheduling never allocates, captures have to fit in STORAGE bytes
+struct job {
+    static constexpr size_t STORAGE = 48;
+
+    void (*invoke)(void* storage) = nullptr;  //runs and destroys the stored callable
+    jobCounter* counter = nullptr;
+    const jobCounter* dependency = nullptr;   //the job is held back until this reaches zero
+    std::atomic<bool> inFlight = false;       //set from submit until it has run, the pool slot is not reused before
+    alignas(std::max_align_t) std::byte storage[STORAGE];
+};
+
+// JOB SYSTEM - one worker per core, each with a work stealing deque, idle workers steal from the others
+// threads that were not registered run their jobs inline, as does everything before init
+class jobSystem {
+public:
+    static constexpr size_t QUEUE_SIZE = 4096;       //queued jobs per thread
+    static constexpr size_t POOL_SIZE = 4096;        //job slots per submitting thread, reused round robin once they have run
+    static constexpr size_t MAX_EXTERNAL_THREADS = 4;
+
+    // workerCount 0 uses one worker per hardware thread besides the calling one, which is registered too
+    static void init(unsigned workerCount = 0);
+    // call once no jobs are outstanding
+    static void shutdown();
+    // stops and joins the workers but keeps every thread's deque and job pool alive, so a thread still
+    // inside wait() on its own slot returns instead of touching freed memory, run by a fatal error
+    static void stopWorkers();
+    // gives the calling thread its own deque so it can submit jobs and help while waiting
+    static bool registerThread();
+
+    template <typename Task>
+    static void run(Task&& task, jobCounter* counter = nullptr, const jobCounter* dependency = nullptr) {
+        using stored = std::decay_t<Task>;
+        static_assert(sizeof(stored) <= job::STORAGE, "job captures too large, capture by reference or pointer instead");
+        static_assert(alignof(stored) <= alignof(std::max_align_t));
+        if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+        threadSlot* slot = currentSlot();
+        if (!slot) {
+            // no deque to push to, honour the dependency by helping until it is met
+            if (dependency) wait(*dependency);
+            task();
+            if (counter) counter->pending.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+        job* newJob = &slot->pool[slot->allocated++ % POOL_SIZE];
+        while (newJob->inFlight.load(std::memory_order_acquire)) {
+            helpOnce(slot);
+        }
+        newJob->inFlight.store(true, std::memory_order_relaxed);
+        new (newJob->storage) stored(std::forward<Task>(task));
+        newJob->invoke = [](void* storage) {
+            auto* callable = std::launder(reinterpret_cast<stored*>(storage));
+            (*callable)();
+            callable->~stored();
+        };
+        newJob->counter = counter;
+        newJob->dependency = dependency;
+        submit(slot, newJob);
+    }
+
+    // runs other jobs until the counter reaches zero, or returns early once the workers are stopped
+    static void wait(const jobCounter& counter);
+
+    // splits items into chunks of at most grain elements and calls body(std::span<T>) for each in parallel
+    template <typename T, typename Body>
+    static void parallelFor(std::span<T> items, const size_t grain, Body&& body) {
+        if (items.empty()) return;
+        const size_t chunkSize = std::max<size_t>(grain, 1);
+        jobCounter counter;
+        for (size_t begin = 0; begin < items.size(); begin += chunkSize) {
+            const std::span<T> chunk = items.subspan(begin, std::min(chunkSize, items.size() - begin));
+            run([chunk, &body] { body(chunk); }, &counter);
+        }
+        wait(counter);
+    }
+
+    [[nodiscard]] static unsigned getWorkerCount() { return static_cast<unsigned>(_workers.size()); }
+    [[nodiscard]] static bool isRunning() { return _running.load(std::memory_order_acquire); }
+    // registered threads have an index below getThreadCount(), unregistered ones get -1
+    [[nodiscard]] static int getThreadIndex() { return currentSlot() ? _slot : -1; }
+    [[nodiscard]] static size_t getThreadCount() { return isRunning() ? _slotCount : 0; }
+private:
+    struct threadSlot {
+        workStealingDeque<job*, QUEUE_SIZE> queue;
+        std::unique_ptr<job[]> pool = std::make_unique<job[]>(POOL_SIZE);
+        size_t allocated = 0;
+        uint32_t random = 0;  //steal victim selection
+        std::atomic<bool> stopped = false;  //worker slots only, set once the worker left its loop
+    };
+
+    static threadSlot* currentSlot() { return _slot >= 0 && isRunning() ? &_slots[_slot] : nullptr; }
+    static void submit(threadSlot* slot, job* newJob);
+    static job* findJob(threadSlot* slot);
+    static void execute(job* current);
+    static void helpOnce(threadSlot* slot);
+    static void workerLoop(int slot);
+
+    static inline std::unique_ptr<threadSlot[]> _slots;
+    static inline size_t _slotCount = 0;
+    static inline std::atomic<size_t> _registeredSlots = 0;
+    static inline std::vector<std::thread> _workers;
+    static inline std::atomic<bool> _running = false;
+    static inline thread_local int _slot = -1;
+
+    static inline std::mutex _sleepMutex;
+    static inline std::condition_variable _wake;
+    static inline std::atomic<uint32_t> _sleeping = 0;
+    static inline logger<LogCategory::CORE> _log;
+};
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// MPSC QUEUE - bounded lock-free ring, any number of threads push and a single thread pops
+// every cell carries a sequence number so producers claim slots with one CAS and never block each other
+template <typename T, size_t Capacity>
+class mpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "mpscQueue capacity must be a power of two");
+public:
+    mpscQueue() : _cells(std::make_unique<cell[]>(Capacity)) {
+        for (size_t i = 0; i < Capacity; i++) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    mpscQueue(const mpscQueue&) = delete;
+    mpscQueue& operator=(const mpscQueue&) = delete;
+
+    // returns false when the queue is full, the value is left untouched
+    bool tryPush(T&& value) {
+        size_t position = _enqueue.load(std::memory_order_relaxed);
+        for (;;) {
+            cell& slot = _cells[position & (Capacity - 1)];
+            const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0) {
+                if (_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // consumer thread only
+    bool tryPop(T& value) {
+        cell& slot = _cells[_dequeue & (Capacity - 1)];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(_dequeue + 1) < 0) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.sequence.store(_dequeue + Capacity, std::memory_order_release);
+        _dequeue++;
+        return true;
+    }
+
+    // consumer thread only
+    [[nodiscard]] bool empty() const {
+        return _cells[_dequeue & (Capacity - 1)].sequence.load(std::memory_order_acquire) != _dequeue + 1;
+    }
+private:
+    struct cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+    std::unique_ptr<cell[]> _cells;
+    alignas(64) std::atomic<size_t> _enqueue = 0;
+    alignas(64) size_t _dequeue = 0;
+};
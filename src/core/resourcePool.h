@@ -0,0 +1,121 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// 32 bit reference into a resourcePool, the low bits index a slot and the high bits hold the slot's generation
+// freeing a slot bumps its generation so handles to the old resource stop resolving instead of dangling
+template <typename T>
+struct handle {
+    static constexpr uint32_t INDEX_BITS = 20;
+    static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+    static constexpr uint32_t MAX_GENERATION = (1u << (32 - INDEX_BITS)) - 1;
+
+    uint32_t value = 0;  //generations start at 1 so a default handle never resolves
+
+    static handle make(const uint32_t index, const uint32_t generation) { return { generation << INDEX_BITS | index }; }
+    [[nodiscard]] uint32_t index() const { return value & INDEX_MASK; }
+    [[nodiscard]] uint32_t generation() const { return value >> INDEX_BITS; }
+    explicit operator bool() const { return value != 0; }
+    bool operator==(const handle&) const = default;
+};
+
+// RESOURCE POOL - owns objects of one type in fixed size chunks so they are stored contiguously and never move,
+// freed slots are reused and a slot whose generation runs out is retired rather than risk an old handle matching
+template <typename T>
+class resourcePool {
+public:
+    static constexpr uint32_t CHUNK_SIZE = 256;
+
+    resourcePool() = default;
+    resourcePool(const resourcePool&) = delete;
+    resourcePool& operator=(const resourcePool&) = delete;
+    ~resourcePool() { clear(); }
+
+    // returns an invalid handle once every index is in use
+    template <typename... Args>
+    handle<T> create(Args&&... args) {
+        uint32_t index;
+        if (!_free.empty()) {
+            index = _free.back();
+            _free.pop_back();
+        } else {
+            if (_capacity > handle<T>::INDEX_MASK) return {};
+            index = _capacity++;
+            if (index % CHUNK_SIZE == 0) {
+                _chunks.push_back(std::make_unique<chunk>());
+            }
+        }
+        chunk& owner = chunkOf(index);
+        const uint32_t slot = index % CHUNK_SIZE;
+        new (owner.objects[slot]) T(std::forward<Args>(args)...);
+        owner.alive[slot] = true;
+        _count++;
+        return handle<T>::make(index, owner.generations[slot]);
+    }
+
+    // stale handles are ignored
+    bool destroy(const handle<T> resource) {
+        T* object = get(resource);
+        if (!object) return false;
+        object->~T();
+        chunk& owner = chunkOf(resource.index());
+        const uint32_t slot = resource.index() % CHUNK_SIZE;
+        owner.alive[slot] = false;
+        if (++owner.generations[slot] <= handle<T>::MAX_GENERATION) {
+            _free.push_back(resource.index());
+        }
+        _count--;
+        return true;
+    }
+
+    // nullptr once the resource has been destroyed, whatever reused its slot since
+    [[nodiscard]] T* get(const handle<T> resource) {
+        const uint32_t index = resource.index();
+        if (index >= _capacity) return nullptr;
+        chunk& owner = chunkOf(index);
+        const uint32_t slot = index % CHUNK_SIZE;
+        if (!owner.alive[slot] || owner.generations[slot] != resource.generation()) return nullptr;
+        return std::launder(reinterpret_cast<T*>(owner.objects[slot]));
+    }
+    [[nodiscard]] const T* get(const handle<T> resource) const { return const_cast<resourcePool*>(this)->get(resource); }
+    [[nodiscard]] bool isValid(const handle<T> resource) const { return get(resource) != nullptr; }
+
+    // visits live objects in storage order, body(handle<T>, T&)
+    template <typename Body>
+    void forEach(Body&& body) {
+        for (uint32_t index = 0; index < _capacity; index++) {
+            chunk& owner = chunkOf(index);
+            const uint32_t slot = index % CHUNK_SIZE;
+            if (owner.alive[slot]) {
+                body(handle<T>::make(index, owner.generations[slot]), *std::launder(reinterpret_cast<T*>(owner.objects[slot])));
+            }
+        }
+    }
+
+    void clear() {
+        forEach([this](const handle<T> resource, T&) { destroy(resource); });
+    }
+
+    [[nodiscard]] size_t size() const { return _count; }
+private:
+    // objects are packed together, the bookkeeping lives in separate arrays so iterating touches only what it needs
+    struct chunk {
+        alignas(T) std::byte objects[CHUNK_SIZE][sizeof(T)];
+        uint16_t generations[CHUNK_SIZE];
+        bool alive[CHUNK_SIZE]{};
+        chunk() { std::fill(std::begin(generations), std::end(generations), uint16_t{ 1 }); }
+    };
+
+    chunk& chunkOf(const uint32_t index) { return *_chunks[index / CHUNK_SIZE]; }
+
+    std::vector<std::unique_ptr<chunk>> _chunks;
+    std::vector<uint32_t> _free;
+    uint32_t _capacity = 0;  //slots ever handed out, every index below it has storage
+    size_t _count = 0;
+};
@@ -1,16 +1,34 @@
-#pragma once
-
-class timestep {
-public:
-    timestep(float deltaTime = 0.0f) : _deltaTime(deltaTime) {}
-    explicit operator float() const { return _deltaTime; } // Implicit conversion to float
-private:
-    float _deltaTime = 0.0f; // Time since last frame
-};
-
-template <>
-struct std::formatter<timestep> : std::formatter<float> {
-    auto format(const timestep& t, format_context& ctx) const {
-        return formatter<float>::format(static_cast<float>(t), ctx);
-    }
-};
\ No newline at end of file
+#pragma once
+#include <cstdint>
+#include <format>
+
+// a span of engine time, exact integer nanosecond ticks plus the same span in double seconds
+class timestep {
+public:
+    static constexpr int64_t TICKS_PER_SECOND = 1'000'000'000;
+
+    timestep(float deltaTime = 0.0f) : timestep(static_cast<double>(deltaTime)) {}
+    explicit timestep(const double seconds)
+        : _ticks(static_cast<int64_t>(seconds * TICKS_PER_SECOND + (seconds < 0.0 ? -0.5 : 0.5))), _seconds(seconds) {}
+    static timestep fromTicks(const int64_t ticks) {
+        timestep step;
+        step._ticks = ticks;
+        step._seconds = static_cast<double>(ticks) / TICKS_PER_SECOND;
+        return step;
+    }
+
+    [[nodiscard]] int64_t getTicks() const { return _ticks; }
+    [[nodiscard]] double getSeconds() const { return _seconds; }
+    [[nodiscard]] double getMilliseconds() const { return _seconds * 1000.0; }
+    explicit operator float() const { return static_cast<float>(_seconds); } // Implicit conversion to float
+private:
+    int64_t _ticks = 0;     // Time since last frame
+    double _seconds = 0.0;
+};
+
+template <>
+struct std::formatter<timestep> : std::formatter<double> {
+    auto format(const timestep& t, format_context& ctx) const {
+        return formatter<double>::format(t.getSeconds(), ctx);
+    }
+};
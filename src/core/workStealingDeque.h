@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// WORK STEALING DEQUE - fixed size Chase-Lev deque of pointers, the owning thread pushes and pops at the bottom
+// without contention while any other thread may steal from the top
+template <typename T, size_t Capacity>
+class workStealingDeque {
+    static_assert(std::is_pointer_v<T>, "workStealingDeque holds pointers");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "workStealingDeque capacity must be a power of two");
+public:
+    // owner only, returns false when full
+    bool push(const T item) {
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const int64_t top = _top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<int64_t>(Capacity)) return false;
+        _items[bottom & MASK].store(item, std::memory_order_relaxed);
+        // publishes the item to thieves, they read bottom with acquire
+        _bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    // owner only, newest item first, nullptr when empty or the last item was stolen
+    T pop() {
+        const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = _top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T item = _items[bottom & MASK].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // last item, race the thieves for it
+            if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // any thread, oldest item first, nullptr when empty or another thread won the race
+    T steal() {
+        int64_t top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = _bottom.load(std::memory_order_acquire);
+        if (top >= bottom) return nullptr;
+        T item = _items[top & MASK].load(std::memory_order_relaxed);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _top.load(std::memory_order_relaxed) >= _bottom.load(std::memory_order_relaxed);
+    }
+private:
+    static constexpr int64_t MASK = static_cast<int64_t>(Capacity) - 1;
+
+    alignas(64) std::atomic<int64_t> _top = 0;
+    alignas(64) std::atomic<int64_t> _bottom = 0;
+    std::array<std::atomic<T>, Capacity> _items{};
+};
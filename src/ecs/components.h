@@ -0,0 +1,36 @@
+#pragma once
+#include "math/math.h"
+
+// plain data only, the world moves components between chunks with memcpy
+
+struct transform {
+    Vec3 position;
+    Vec3 scale{ 1.0f };
+    float angle = 0.0f;  //degrees around z
+};
+
+// transform at the previous simulation step, rendering blends towards the current one
+struct previousTransform {
+    Vec3 position;
+    float angle = 0.0f;
+};
+
+struct motion {
+    Vec3 velocity;
+    float spin = 0.0f;  //degrees per second
+};
+
+// steered by the keyboard, the player has no motion component
+struct playerControl {};
+
+// local space box of the drawn mesh
+struct localBounds {
+    Vec3 min;
+    Vec3 max;
+};
+
+// written by the transform pass every frame, read by culling and extraction
+struct worldTransform {
+    Mat4 matrix;
+    bool visible = true;
+};
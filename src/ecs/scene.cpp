@@ -0,0 +1,140 @@
+#include "scene.h"
+#include <cmath>
+#include <random>
+#include "input/input.h"
+#include "input/keycodes.h"
+#include "profiling/cpuProfiler.h"
+
+void scene::init(const size_t entityCount, const Vec3& meshMin, const Vec3& meshMax) {
+    SKETCH_PROFILE_FUNCTION();
+    memoryScope scope(MemoryTag::SCENE);
+    const localBounds bounds{ meshMin, meshMax };
+    _world.create(transform{}, previousTransform{}, playerControl{}, bounds, worldTransform{});
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-AREA_EXTENT, AREA_EXTENT);
+    std::uniform_real_distribution<float> speed(-0.5f, 0.5f);
+    std::uniform_real_distribution<float> size(0.1f, 0.4f);
+    std::uniform_real_distribution<float> spin(-90.0f, 90.0f);
+    for (size_t i = 1; i < entityCount; i++) {
+        transform placed;
+        placed.position = { position(random), position(random), 0.0f };
+        placed.scale = Vec3(size(random));
+        const motion moving{ { speed(random), speed(random), 0.0f }, spin(random) };
+        _world.create(placed, previousTransform{ placed.position, placed.angle }, moving, bounds, worldTransform{});
+    }
+    _log.info("Scene created with {} entities in {} archetypes", _world.getEntityCount(), _world.getArchetypeCount());
+}
+
+void scene::fixedUpdate(const timestep step) {
+    SKETCH_PROFILE_FUNCTION();
+    const float seconds = static_cast<float>(step);
+
+    // player input, a single entity so it stays on this thread
+    Vec3 direction;
+    if (input::getKey(key.left) || input::getKey(key.a)) direction = direction + Vec3::left();
+    if (input::getKey(key.right) || input::getKey(key.d)) direction = direction + Vec3::right();
+    if (input::getKey(key.up) || input::getKey(key.w)) direction = direction + Vec3::up();
+    if (input::getKey(key.down) || input::getKey(key.s)) direction = direction + Vec3::down();
+    const Vec3 velocity = direction.normalize() * (MOVE_SPEED * seconds);
+    _world.each<previousTransform, transform, const playerControl>([&velocity](previousTransform& previous, transform& current, const playerControl&) {
+        previous.position = current.position;
+        current.position += velocity;
+    });
+
+    // drifting objects bounce off the edges of the area
+    _world.parallelEach<previousTransform, transform, motion>([seconds](previousTransform& previous, transform& current, motion& moving) {
+        previous.position = current.position;
+        previous.angle = current.angle;
+        current.position += moving.velocity * seconds;
+        current.angle += moving.spin * seconds;
+        if (std::abs(current.angle) >= 360.0f) {
+            // both ends shift together so the blend between them does not spin back the long way
+            const float turn = std::copysign(360.0f, current.angle);
+            current.angle -= turn;
+            previous.angle -= turn;
+        }
+        if (std::abs(current.position.x) > AREA_EXTENT) moving.velocity.x = std::copysign(moving.velocity.x, -current.position.x);
+        if (std::abs(current.position.y) > AREA_EXTENT) moving.velocity.y = std::copysign(moving.velocity.y, -current.position.y);
+    }, CHUNKS_PER_JOB);
+}
+
+void scene::updateTransforms(const float alpha) {
+    SKETCH_PROFILE_FUNCTION();
+    _world.parallelEach<const previousTransform, const transform, worldTransform>([alpha](const previousTransform& previous, const transform& current, worldTransform& placed) {
+        const Vec3 position = previous.position.lerp(current.position, alpha);
+        const float angle = previous.angle + (current.angle - previous.angle) * alpha;
+        placed.matrix = Mat4::translation(position) * Mat4::rotationZ(angle) * Mat4::scale(current.scale);
+    }, CHUNKS_PER_JOB);
+}
+
+// the same clip space test the GPU applies, culled only when every corner is outside one plane
+bool scene::isOnScreen(const worldTransform& placed, const localBounds& bounds) const {
+    const Mat4 clip = _viewProjection * placed.matrix;
+    uint32_t outside[6]{};
+    for (int corner = 0; corner < 8; corner++) {
+        const float local[4] = { corner & 1 ? bounds.max.x : bounds.min.x, corner & 2 ? bounds.max.y : bounds.min.y, corner & 4 ? bounds.max.z : bounds.min.z, 1.0f };
+        float point[4];
+        for (int row = 0; row < 4; row++) {
+            point[row] = clip.m[row][0] * local[0] + clip.m[row][1] * local[1] + clip.m[row][2] * local[2] + clip.m[row][3] * local[3];
+        }
+        for (int axis = 0; axis < 3; axis++) {
+            outside[axis * 2] += point[axis] < -point[3];
+            outside[axis * 2 + 1] += point[axis] > point[3];
+        }
+    }
+    for (const uint32_t count : outside) {
+        if (count == 8) return false;
+    }
+    return true;
+}
+
+void scene::extract(const float alpha, frameSnapshot& snapshot) {
+    SKETCH_PROFILE_FUNCTION();
+    memoryScope scope(MemoryTag::SCENE);
+    updateTransforms(alpha);
+
+    // count what survives culling per chunk, then give every chunk its own range of the output
+    const std::span<const queryChunk> chunks = _world.query<worldTransform, const localBounds>();
+    _visibleCounts.assign(chunks.size(), 0);
+    _firstVisible.resize(chunks.size());
+    {
+        SKETCH_PROFILE_SCOPE("cull");
+        jobSystem::parallelFor(chunks, CHUNKS_PER_JOB, [this](const std::span<const queryChunk> batch) {
+            for (const queryChunk& chunk : batch) {
+                worldTransform* placed = chunk.get<worldTransform>();
+                const localBounds* bounds = chunk.get<localBounds>();
+                uint32_t visible = 0;
+                for (uint32_t row = 0; row < chunk.count(); row++) {
+                    placed[row].visible = isOnScreen(placed[row], bounds[row]);
+                    visible += placed[row].visible;
+                }
+                _visibleCounts[chunk.index] = visible;
+            }
+        });
+    }
+    uint32_t total = 0;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        _firstVisible[i] = total;
+        total += _visibleCounts[i];
+    }
+
+    // entity indices stay put while an entity lives, so they double as the renderer's occlusion keys
+    snapshot.models.resize(total);
+    snapshot.objectIds.resize(total);
+    jobSystem::parallelFor(chunks, CHUNKS_PER_JOB, [this, &snapshot](const std::span<const queryChunk> batch) {
+        for (const queryChunk& chunk : batch) {
+            const worldTransform* placed = chunk.get<const worldTransform>();
+            const entity* owners = chunk.entities();
+            uint32_t out = _firstVisible[chunk.index];
+            for (uint32_t row = 0; row < chunk.count(); row++) {
+                if (!placed[row].visible) continue;
+                snapshot.models[out] = placed[row].matrix;
+                snapshot.objectIds[out] = owners[row].index();
+                out++;
+            }
+        }
+    });
+    snapshot.view = _view;
+    snapshot.projection = _projection;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <vector>
+#include "world.h"
+#include "components.h"
+#include "core/timestep.h"
+#include "core/frameSnapshot.h"
+
+// SCENE - the simulated objects and the camera, systems run one after another and each spreads its chunks over the job system
+class scene {
+public:
+    // a player quad at the origin plus drifting quads, seeded so replays see the same scene every run
+    void init(size_t entityCount, const Vec3& meshMin, const Vec3& meshMax);
+    void setCamera(const Mat4& view, const Mat4& projection) { _view = view; _projection = projection; _viewProjection = projection * view; }
+
+    // runs at the simulation rate
+    void fixedUpdate(timestep step);
+    // interpolates between the last two simulation steps, culls against the camera and writes the visible objects out
+    void extract(float alpha, frameSnapshot& snapshot);
+
+    [[nodiscard]] world& getWorld() { return _world; }
+private:
+    void updateTransforms(float alpha);
+    [[nodiscard]] bool isOnScreen(const worldTransform& placed, const localBounds& bounds) const;
+
+    static constexpr float MOVE_SPEED = 1.5f;
+    static constexpr float AREA_EXTENT = 2.0f;  //drifting objects bounce inside this box, it reaches past the edges of the view
+    static constexpr size_t CHUNKS_PER_JOB = 4;
+
+    world _world;
+    Mat4 _view;
+    Mat4 _projection;
+    Mat4 _viewProjection;
+    std::vector<uint32_t> _visibleCounts;  //per query chunk, reused every frame
+    std::vector<uint32_t> _firstVisible;   //prefix sum of the counts, where each chunk writes into the snapshot
+    static inline logger<LogCategory::CORE> _log;
+};
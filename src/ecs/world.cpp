@@ -0,0 +1,148 @@
+#include "world.h"
+#include <algorithm>
+
+uint32_t componentRegistry::registerComponent(const size_t size, const size_t alignment) {
+    std::lock_guard lock(_mutex);
+    if (_count >= MAX_COMPONENTS) {
+        _log.error("More than {} component types registered", MAX_COMPONENTS);
+    }
+    _sizes[_count] = size;
+    _alignments[_count] = alignment;
+    return _count++;
+}
+
+archetype::archetype(const componentMask mask) : _mask(mask) {
+    for (uint32_t component = 0; component < componentRegistry::MAX_COMPONENTS; component++) {
+        if (has(component)) _components.push_back(component);
+    }
+    // largest alignment first keeps the padding between arrays small
+    std::ranges::stable_sort(_components, std::greater{}, componentRegistry::getAlignment);
+
+    size_t rowBytes = sizeof(entity);
+    for (const uint32_t component : _components) {
+        rowBytes += componentRegistry::getSize(component);
+    }
+    // start from the unpadded row count and back off until every aligned array fits
+    _capacity = static_cast<uint32_t>(chunkStorage::BYTES / rowBytes);
+    while (_capacity > 0) {
+        size_t offset = sizeof(entity) * _capacity;
+        for (const uint32_t component : _components) {
+            const size_t alignment = componentRegistry::getAlignment(component);
+            offset = (offset + alignment - 1) / alignment * alignment;
+            _offsets[component] = static_cast<uint32_t>(offset);
+            offset += componentRegistry::getSize(component) * _capacity;
+        }
+        if (offset <= chunkStorage::BYTES) break;
+        _capacity--;
+    }
+    if (_capacity == 0) {
+        _log.error("Components of archetype {:#x} do not fit in a {} byte chunk", mask, chunkStorage::BYTES);
+    }
+}
+
+void archetype::add(const entity owner, uint32_t& chunkIndex, uint32_t& row) {
+    if (_chunks.empty() || _chunks.back()->count == _capacity) {
+        _chunks.push_back(std::make_unique<archetypeChunk>());
+    }
+    archetypeChunk& chunk = *_chunks.back();
+    chunkIndex = static_cast<uint32_t>(_chunks.size() - 1);
+    row = chunk.count++;
+    entities(chunk)[row] = owner;
+}
+
+entity archetype::remove(const uint32_t chunkIndex, const uint32_t row) {
+    archetypeChunk& chunk = *_chunks[chunkIndex];
+    archetypeChunk& last = *_chunks.back();
+    const uint32_t lastRow = last.count - 1;
+    entity moved;
+    if (&chunk != &last || row != lastRow) {
+        moved = entities(last)[lastRow];
+        entities(chunk)[row] = moved;
+        for (const uint32_t component : _components) {
+            const size_t size = componentRegistry::getSize(component);
+            std::memcpy(column(chunk, component) + row * size, column(last, component) + lastRow * size, size);
+        }
+    }
+    // the last chunk is the only one that can empty, the first is kept for the next add
+    if (--last.count == 0 && _chunks.size() > 1) {
+        _chunks.pop_back();
+    }
+    return moved;
+}
+
+entity world::allocate() {
+    uint32_t index;
+    if (!_free.empty()) {
+        index = _free.back();
+        _free.pop_back();
+    } else {
+        if (_records.size() > entity::INDEX_MASK) {
+            _log.error("Out of entity indices, {} are alive", _count);
+        }
+        index = static_cast<uint32_t>(_records.size());
+        _records.emplace_back();
+    }
+    record& created = _records[index];
+    created.alive = true;
+    _count++;
+    return entity::make(index, created.generation);
+}
+
+archetype& world::getArchetype(const componentMask mask) {
+    if (const auto found = _archetypeByMask.find(mask); found != _archetypeByMask.end()) {
+        return *found->second;
+    }
+    archetype* created = _archetypes.emplace_back(std::make_unique<archetype>(mask)).get();
+    _archetypeByMask.emplace(mask, created);
+    return *created;
+}
+
+void world::place(const entity target, archetype& owner) {
+    record& location = _records[target.index()];
+    location.owner = &owner;
+    owner.add(target, location.chunk, location.row);
+}
+
+void world::move(const entity target, archetype& destination) {
+    record& location = _records[target.index()];
+    archetype& source = *location.owner;
+    archetypeChunk& from = *source.getChunks()[location.chunk];
+    const uint32_t fromRow = location.row;
+
+    uint32_t chunkIndex, row;
+    destination.add(target, chunkIndex, row);
+    archetypeChunk& to = *destination.getChunks()[chunkIndex];
+    for (const uint32_t component : destination.getComponents()) {
+        if (!source.has(component)) continue;
+        const size_t size = componentRegistry::getSize(component);
+        std::memcpy(destination.column(to, component) + row * size, source.column(from, component) + fromRow * size, size);
+    }
+    if (const entity moved = source.remove(location.chunk, fromRow)) {
+        _records[moved.index()].chunk = location.chunk;
+        _records[moved.index()].row = fromRow;
+    }
+    location.owner = &destination;
+    location.chunk = chunkIndex;
+    location.row = row;
+}
+
+void world::destroy(const entity target) {
+    if (!isAlive(target)) return;
+    record& location = _records[target.index()];
+    if (const entity moved = location.owner->remove(location.chunk, location.row)) {
+        _records[moved.index()].chunk = location.chunk;
+        _records[moved.index()].row = location.row;
+    }
+    location.owner = nullptr;
+    location.alive = false;
+    _count--;
+    // same retirement rule as resourcePool, an index whose generation runs out is never handed out again
+    if (++location.generation <= entity::MAX_GENERATION) {
+        _free.push_back(target.index());
+    }
+}
+
+bool world::isAlive(const entity target) const {
+    const uint32_t index = target.index();
+    return index < _records.size() && _records[index].alive && _records[index].generation == target.generation();
+}
@@ -0,0 +1,223 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "core/resourcePool.h"
+#include "core/jobSystem.h"
+#include "logging/logger.h"
+
+struct entityTag;
+using entity = handle<entityTag>;  //same index and generation layout as resource handles
+using componentMask = uint64_t;
+
+// COMPONENT REGISTRY - hands out a small id per component type on first use, ids index archetype layouts
+class componentRegistry {
+public:
+    static constexpr uint32_t MAX_COMPONENTS = 64;  //one bit each in a componentMask
+
+    // components are moved between chunks with memcpy, so they have to be plain data
+    template <typename T>
+    static uint32_t id() {
+        if constexpr (!std::is_same_v<T, std::remove_cv_t<T>>) {
+            return id<std::remove_cv_t<T>>();  //const T shares the id of T
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>, "components must be trivially copyable");
+            static const uint32_t value = registerComponent(sizeof(T), alignof(T));
+            return value;
+        }
+    }
+    [[nodiscard]] static size_t getSize(uint32_t component) { return _sizes[component]; }
+    [[nodiscard]] static size_t getAlignment(uint32_t component) { return _alignments[component]; }
+private:
+    static uint32_t registerComponent(size_t size, size_t alignment);
+
+    static inline size_t _sizes[MAX_COMPONENTS]{};
+    static inline size_t _alignments[MAX_COMPONENTS]{};
+    static inline uint32_t _count = 0;
+    static inline std::mutex _mutex;
+    static inline logger<LogCategory::CORE> _log;
+};
+
+// raw storage for one chunk, every archetype carves it into one array per component
+struct alignas(64) chunkStorage {
+    static constexpr size_t BYTES = 16 * 1024;
+    std::byte bytes[BYTES];
+};
+
+struct archetypeChunk {
+    std::unique_ptr<chunkStorage> storage = std::make_unique<chunkStorage>();
+    uint32_t count = 0;
+};
+
+// ARCHETYPE - every entity with exactly one set of components, stored in chunks of structure of arrays
+// chunks stay packed: removal moves the very last entity into the hole so only the last chunk is ever partly full
+class archetype {
+public:
+    explicit archetype(componentMask mask);
+
+    [[nodiscard]] componentMask getMask() const { return _mask; }
+    [[nodiscard]] bool has(const uint32_t component) const { return (_mask >> component) & 1; }
+    [[nodiscard]] uint32_t getCapacity() const { return _capacity; }
+    [[nodiscard]] std::span<const uint32_t> getComponents() const { return _components; }
+    [[nodiscard]] std::vector<std::unique_ptr<archetypeChunk>>& getChunks() { return _chunks; }
+
+    [[nodiscard]] entity* entities(archetypeChunk& chunk) const { return reinterpret_cast<entity*>(chunk.storage->bytes); }
+    [[nodiscard]] std::byte* column(archetypeChunk& chunk, const uint32_t component) const { return chunk.storage->bytes + _offsets[component]; }
+    template <typename T>
+    [[nodiscard]] T* components(archetypeChunk& chunk) const {
+        return std::launder(reinterpret_cast<T*>(column(chunk, componentRegistry::id<T>())));
+    }
+
+    // appends a row with uninitialised components, returns where it went
+    void add(entity owner, uint32_t& chunkIndex, uint32_t& row);
+    // fills the hole with the last row, returns the entity that moved into it or an invalid handle if none did
+    entity remove(uint32_t chunkIndex, uint32_t row);
+private:
+    componentMask _mask;
+    std::vector<uint32_t> _components;
+    uint32_t _offsets[componentRegistry::MAX_COMPONENTS]{};  //start of each component array inside a chunk
+    uint32_t _capacity = 0;
+    std::vector<std::unique_ptr<archetypeChunk>> _chunks;
+    static inline logger<LogCategory::CORE> _log;
+};
+
+// one chunk matched by a query, index is its position in the query result so systems can keep per chunk data
+struct queryChunk {
+    archetype* owner = nullptr;
+    archetypeChunk* chunk = nullptr;
+    uint32_t index = 0;
+
+    [[nodiscard]] uint32_t count() const { return chunk->count; }
+    [[nodiscard]] const entity* entities() const { return owner->entities(*chunk); }
+    template <typename T>
+    [[nodiscard]] T* get() const { return owner->components<T>(*chunk); }
+};
+
+// WORLD - entities and their components grouped by archetype, queries walk the matching chunks
+// structural changes (create, destroy, add, remove) must not happen while a query is being iterated,
+// queries are issued from one thread at a time and the parallel forms spread the chunks over the job system
+class world {
+public:
+    world() = default;
+    world(const world&) = delete;
+    world& operator=(const world&) = delete;
+
+    template <typename... Ts>
+    entity create(const Ts&... components) {
+        const entity created = allocate();
+        place(created, getArchetype(maskOf<Ts...>()));
+        (std::memcpy(get<Ts>(created), &components, sizeof(Ts)), ...);
+        return created;
+    }
+    void destroy(entity target);
+    [[nodiscard]] bool isAlive(entity target) const;
+
+    // nullptr when the entity is gone or lacks the component
+    template <typename T>
+    [[nodiscard]] T* get(const entity target) {
+        const uint32_t component = componentRegistry::id<T>();
+        if (!isAlive(target)) return nullptr;
+        const record& location = _records[target.index()];
+        if (!location.owner->has(component)) return nullptr;
+        archetypeChunk& chunk = *location.owner->getChunks()[location.chunk];
+        return std::launder(reinterpret_cast<T*>(location.owner->column(chunk, component) + location.row * sizeof(T)));
+    }
+
+    // both move the entity to the archetype with the new component set
+    template <typename T>
+    void add(const entity target, const T& component) {
+        if (!isAlive(target)) return;
+        const componentMask mask = _records[target.index()].owner->getMask() | bit<T>();
+        if (mask != _records[target.index()].owner->getMask()) {
+            move(target, getArchetype(mask));
+        }
+        std::memcpy(get<T>(target), &component, sizeof(T));
+    }
+    template <typename T>
+    void remove(const entity target) {
+        if (!isAlive(target)) return;
+        const componentMask mask = _records[target.index()].owner->getMask() & ~bit<T>();
+        if (mask != _records[target.index()].owner->getMask()) {
+            move(target, getArchetype(mask));
+        }
+    }
+
+    // every non empty chunk holding all of Ts, valid until the next query or structural change
+    template <typename... Ts>
+    std::span<const queryChunk> query() {
+        const componentMask required = maskOf<Ts...>();
+        _queryChunks.clear();
+        for (const auto& candidate : _archetypes) {
+            if ((candidate->getMask() & required) != required) continue;
+            for (const auto& chunk : candidate->getChunks()) {
+                if (chunk->count == 0) continue;
+                _queryChunks.push_back({ candidate.get(), chunk.get(), static_cast<uint32_t>(_queryChunks.size()) });
+            }
+        }
+        return _queryChunks;
+    }
+
+    // body(Ts&... components) for every matching entity, const Ts are read only by convention
+    template <typename... Ts, typename Body>
+    void each(Body&& body) {
+        for (const queryChunk& chunk : query<Ts...>()) {
+            eachInChunk<Ts...>(chunk, body);
+        }
+    }
+    template <typename... Ts, typename Body>
+    void parallelEach(Body&& body, const size_t chunksPerJob = 1) {
+        jobSystem::parallelFor(query<Ts...>(), chunksPerJob, [&body](const std::span<const queryChunk> chunks) {
+            for (const queryChunk& chunk : chunks) {
+                eachInChunk<Ts...>(chunk, body);
+            }
+        });
+    }
+
+    [[nodiscard]] size_t getEntityCount() const { return _count; }
+    [[nodiscard]] size_t getArchetypeCount() const { return _archetypes.size(); }
+private:
+    struct record {
+        archetype* owner = nullptr;
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+        uint16_t generation = 1;
+        bool alive = false;
+    };
+
+    template <typename T>
+    static componentMask bit() { return componentMask{ 1 } << componentRegistry::id<T>(); }
+    template <typename... Ts>
+    static componentMask maskOf() { return (componentMask{ 0 } | ... | bit<Ts>()); }
+
+    template <typename... Ts, typename Body>
+    static void eachInChunk(const queryChunk& chunk, Body& body) {
+        const uint32_t count = chunk.count();
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            const auto columns = std::make_tuple(chunk.get<Ts>()...);
+            for (uint32_t row = 0; row < count; row++) {
+                body(std::get<I>(columns)[row]...);
+            }
+        }(std::index_sequence_for<Ts...>{});
+    }
+
+    entity allocate();
+    archetype& getArchetype(componentMask mask);
+    void place(entity target, archetype& owner);
+    void move(entity target, archetype& destination);
+
+    std::vector<std::unique_ptr<archetype>> _archetypes;
+    std::unordered_map<componentMask, archetype*> _archetypeByMask;
+    std::vector<record> _records;
+    std::vector<uint32_t> _free;
+    std::vector<queryChunk> _queryChunks;  //reused so queries do not allocate once warmed up
+    size_t _count = 0;
+    static inline logger<LogCategory::CORE> _log;
+};
@@ -1,88 +1,191 @@
-#pragma once
-
-#include <unordered_map>
-#include "core/timestep.h"
-#include "logging/logger.h"
-
-struct inputState {
-    bool isDown = false;  //is the key down
-    bool wasDown = false; //was the key down last frame
-    float duration = 0.0f; //amount of time key was held down
-};
-
-class input {
-public:
-    static void onKeyEvent(int keyCode, int action) {
-        auto& state = _inputStates[keyCode];
-        state.isDown = (action == GLFW_PRESS) || (action == GLFW_REPEAT);
-    }
-
-    static void onMouseButtonEvent(int button, int action) {
-        auto& state = _inputStates[button];
-        state.isDown = (action == GLFW_PRESS);
-    }
-
-    static void onMouseMoveEvent(float x, float y) {
-        _mouseX = x;
-        _mouseY = y;
-    }
-
-    static void onMouseWheelEvent(float wheel) {
-        _mouseScroll = wheel;
-    }
-
-    static void update(timestep deltaTime) {
-        for (auto& [keyCode, state] : _inputStates) {
-            state.duration = state.isDown ? state.duration + static_cast<float>(deltaTime) : 0.0f;
-            state.wasDown = state.isDown;
-        }
-        _mouseScroll = 0.0f; // Reset mouse scroll after processing
-    }
-
-    static bool getKey(int keyCode) {
-        return _inputStates[keyCode].isDown;
-    }
-
-    static bool getKeyDown(int keyCode) {
-        const auto& state = _inputStates[keyCode];
-        return !state.wasDown && state.isDown; // key was not down last frame but is down now
-    }
-
-    static bool getKeyUp(int keyCode) {
-        const auto& state = _inputStates[keyCode];
-        return state.wasDown && !state.isDown; // key was down last frame but is not down now
-    }
-
-    static bool getMouse(int mouseCode) {
-        return _inputStates[mouseCode].isDown;
-    }
-
-    static bool getMouseDown(int mouseCode) {
-        const auto& state = _inputStates[mouseCode];
-        return !state.wasDown && state.isDown; // mouse button was not down last frame but is down now
-    }
-
-    static bool getMouseUp(int mouseCode) {
-        const auto& state = _inputStates[mouseCode];
-        return state.wasDown && !state.isDown; // mouse button was down last frame but is not down now
-    }
-
-    static std::pair<float, float> getMousePosition() {
-        return { _mouseX, _mouseY };
-    }
-
-    static float getMouseScroll() {
-        return _mouseScroll;
-    }
-
-    static float getDuration(int code) {
-        return _inputStates[code].duration;
-    }
-
-private:
-    static inline std::unordered_map<int, inputState> _inputStates;
-    static inline float _mouseX = 0.0f;
-    static inline float _mouseY = 0.0f;
-    static inline float _mouseScroll = 0.0f;
-    static inline logger _log;
-};
\ No newline at end of file
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <GLFW/glfw3.h>
+#include <limits>
+#include <utility>
+#include "core/mpscQueue.h"
+#include "core/timestep.h"
+#include "logging/logger.h"
+#include "keycodes.h"
+#include "mousecodes.h"
+#include "inputEventQueue.h"
+
+// dense state for one kind of button, codes index straight into the tables
+// edges are latched as events arrive so a press and release inside one frame still reports both
+template <size_t Count>
+struct buttonStates {
+    std::bitset<Count> isDown;                  //is the button down
+    std::bitset<Count> wasPressed;              //went down since the last update
+    std::bitset<Count> wasReleased;             //went up since the last update
+    std::array<float, Count> duration = {};     //amount of time the button was held down
+
+    static constexpr bool valid(const int code) { return static_cast<unsigned>(code) < Count; }
+
+    bool down(const int code) const { return valid(code) && isDown[code]; }
+    bool pressed(const int code) const { return valid(code) && wasPressed[code]; }
+    bool released(const int code) const { return valid(code) && wasReleased[code]; }
+    float held(const int code) const { return valid(code) ? duration[code] : 0.0f; }
+
+    void set(const int code, const bool state) {
+        if (!valid(code)) return;
+        const bool previous = isDown[code];
+        wasPressed[code] = wasPressed[code] | (state & !previous);
+        wasReleased[code] = wasReleased[code] | (!state & previous);
+        isDown[code] = state;
+    }
+
+    void update(const float deltaTime) {
+        for (size_t i = 0; i < Count; i++) {
+            duration[i] = (duration[i] + deltaTime) * static_cast<float>(isDown[i]);
+        }
+        wasPressed.reset();
+        wasReleased.reset();
+    }
+};
+
+class input {
+public:
+    static constexpr size_t KEY_COUNT = keycodes::last + 1;
+    static constexpr size_t MOUSE_COUNT = mousecodes::last + 1;
+
+    static void onKeyEvent(int keyCode, int action) {
+        applyEvent({ inputEventType::KEY, keyCode, action, 0.0f, 0.0f, now() });
+    }
+
+    static void onMouseButtonEvent(int button, int action) {
+        applyEvent({ inputEventType::MOUSE_BUTTON, button, action, 0.0f, 0.0f, now() });
+    }
+
+    static void onMouseMoveEvent(float x, float y) {
+        applyEvent({ inputEventType::MOUSE_MOVE, 0, 0, x, y, now() });
+    }
+
+    static void onMouseWheelEvent(float wheel) {
+        applyEvent({ inputEventType::MOUSE_WHEEL, 0, 0, 0.0f, wheel, now() });
+    }
+
+    // safe from any thread, the window thread posts here and the thread that owns input applies them
+    // a full queue drops the event rather than stall the window thread
+    static void postEvent(inputEvent event) {
+        if (!_posted.tryPush(std::move(event))) {
+            _postedDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // applies everything posted so far, keeping the time each event was posted at
+    static size_t processPostedEvents() {
+        size_t count = 0;
+        inputEvent event;
+        while (_posted.tryPop(event)) {
+            applyEvent(event);
+            count++;
+        }
+        return count;
+    }
+
+    // same clock and epoch as the profiler and monotonic log timestamps
+    static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - logBackend::epoch()).count();
+    }
+
+    // per frame: takes every queued event in arrival order
+    template <typename Callback>
+    static size_t consumeEvents(Callback&& callback) {
+        return _events.consume(std::numeric_limits<int64_t>::max(), std::forward<Callback>(callback));
+    }
+
+    // per fixed tick: takes only the events that happened before the tick's end time, the rest wait for the next tick
+    template <typename Callback>
+    static size_t consumeEventsUntil(int64_t timeNs, Callback&& callback) {
+        return _events.consume(timeNs, std::forward<Callback>(callback));
+    }
+
+    // arrival time of the oldest unconsumed event, -1 when the queue is empty, for input to photon measurements
+    static int64_t getOldestEventTime() {
+        const inputEvent* event = _events.oldest();
+        return event ? event->timeNs : -1;
+    }
+
+    static uint64_t getDroppedEventCount() {
+        return _events.getDroppedCount() + _postedDropped.load(std::memory_order_relaxed);
+    }
+
+    static void update(timestep deltaTime) {
+        _keys.update(static_cast<float>(deltaTime));
+        _mouseButtons.update(static_cast<float>(deltaTime));
+        _mouseScroll = 0.0f; // Reset mouse scroll after processing
+    }
+
+    static bool getKey(int keyCode) {
+        return _keys.down(keyCode);
+    }
+
+    static bool getKeyDown(int keyCode) {
+        return _keys.pressed(keyCode); // key was not down last frame but is down now
+    }
+
+    static bool getKeyUp(int keyCode) {
+        return _keys.released(keyCode); // key was down last frame but is not down now
+    }
+
+    static bool getMouse(int mouseCode) {
+        return _mouseButtons.down(mouseCode);
+    }
+
+    static bool getMouseDown(int mouseCode) {
+        return _mouseButtons.pressed(mouseCode); // mouse button was not down last frame but is down now
+    }
+
+    static bool getMouseUp(int mouseCode) {
+        return _mouseButtons.released(mouseCode); // mouse button was down last frame but is not down now
+    }
+
+    static std::pair<float, float> getMousePosition() {
+        return { _mouseX, _mouseY };
+    }
+
+    static float getMouseScroll() {
+        return _mouseScroll;
+    }
+
+    static float getDuration(int keyCode) {
+        return _keys.held(keyCode);
+    }
+
+    static float getMouseDuration(int mouseCode) {
+        return _mouseButtons.held(mouseCode);
+    }
+
+private:
+    static void applyEvent(const inputEvent& event) {
+        switch (event.type) {
+            case inputEventType::KEY:
+                _keys.set(event.code, (event.action == GLFW_PRESS) || (event.action == GLFW_REPEAT));
+                break;
+            case inputEventType::MOUSE_BUTTON:
+                _mouseButtons.set(event.code, event.action == GLFW_PRESS);
+                break;
+            case inputEventType::MOUSE_MOVE:
+                _mouseX = event.x;
+                _mouseY = event.y;
+                break;
+            case inputEventType::MOUSE_WHEEL:
+                _mouseScroll = event.y;
+                break;
+        }
+        _events.push(event);
+    }
+
+    static inline buttonStates<KEY_COUNT> _keys;
+    static inline buttonStates<MOUSE_COUNT> _mouseButtons;
+    static inline inputEventQueue _events;
+    static inline mpscQueue<inputEvent, 1024> _posted;
+    static inline std::atomic<uint64_t> _postedDropped = 0;
+    static inline float _mouseX = 0.0f;
+    static inline float _mouseY = 0.0f;
+    static inline float _mouseScroll = 0.0f;
+    static inline logger<LogCategory::INPUT> _log;
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class inputEventType : uint8_t {
+    KEY,
+    MOUSE_BUTTON,
+    MOUSE_MOVE,
+    MOUSE_WHEEL
+};
+
+struct inputEvent {
+    inputEventType type = inputEventType::KEY;
+    int code = 0;        //key or mouse button, unused for move and wheel
+    int action = 0;      //GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+    float x = 0.0f;      //cursor position, or wheel offset in y
+    float y = 0.0f;
+    int64_t timeNs = 0;  //nanoseconds since logBackend::epoch(), taken when the callback fired
+};
+
+// INPUT EVENT QUEUE - fixed ring of raw events in arrival order, when nobody consumes them
+// the oldest events are overwritten so a stalled consumer never grows memory
+class inputEventQueue {
+public:
+    static constexpr size_t CAPACITY = 1024;
+
+    void push(const inputEvent& event) {
+        if (_tail - _head == CAPACITY) {
+            _head++;
+            _dropped++;
+        }
+        _events[_tail++ % CAPACITY] = event;
+    }
+
+    // hands every event stamped at or before untilNs to callback and removes it, later events stay queued
+    template <typename Callback>
+    size_t consume(const int64_t untilNs, Callback&& callback) {
+        size_t count = 0;
+        while (_head != _tail && _events[_head % CAPACITY].timeNs <= untilNs) {
+            callback(_events[_head++ % CAPACITY]);
+            count++;
+        }
+        return count;
+    }
+
+    void clear() { _head = _tail; }
+    [[nodiscard]] size_t size() const { return static_cast<size_t>(_tail - _head); }
+    [[nodiscard]] bool empty() const { return _head == _tail; }
+    [[nodiscard]] const inputEvent* oldest() const { return empty() ? nullptr : &_events[_head % CAPACITY]; }
+    [[nodiscard]] uint64_t getDroppedCount() const { return _dropped; }
+private:
+    std::array<inputEvent, CAPACITY> _events;
+    uint64_t _head = 0;
+    uint64_t _tail = 0;
+    uint64_t _dropped = 0;
+};
@@ -0,0 +1,138 @@
+#include "inputRecorder.h"
+#include <cstring>
+#include "input.h"
+
+static constexpr char MAGIC[7] = { 'S', 'K', 'I', 'N', 'P', 'U', 'T' };
+static constexpr uint8_t VERSION = 2;
+static constexpr uint8_t FRAME = 0xFE;
+static constexpr uint8_t END = 0xFF;
+
+inputRecorder::~inputRecorder() {
+    if (_file) std::fclose(_file);
+}
+
+bool inputRecorder::start(const std::string& filePath) {
+    _file = std::fopen(filePath.c_str(), "wb");
+    if (!_file) {
+        _log.warn("Failed to open input recording: {}", filePath);
+        return false;
+    }
+    std::fwrite(MAGIC, 1, sizeof(MAGIC), _file);
+    put(VERSION);
+    // anything already queued happened before the recording started
+    input::consumeEvents([](const inputEvent&) {});
+    _log.info("Recording input to {}", filePath);
+    return true;
+}
+
+void inputRecorder::write(const uint32_t frame, const inputEvent& event) {
+    put(frame);
+    put(event.type);
+    switch (event.type) {
+        case inputEventType::KEY:
+        case inputEventType::MOUSE_BUTTON:
+            put(static_cast<int16_t>(event.code));
+            put(static_cast<uint8_t>(event.action));
+            break;
+        case inputEventType::MOUSE_MOVE:
+            put(event.x);
+            put(event.y);
+            break;
+        case inputEventType::MOUSE_WHEEL:
+            put(event.y);
+            break;
+    }
+}
+
+void inputRecorder::record(const uint32_t frame, const timestep deltaTime) {
+    if (!_file) return;
+    put(frame);
+    put(FRAME);
+    put(deltaTime.getTicks());
+    input::consumeEvents([this, frame](const inputEvent& event) { write(frame, event); });
+}
+
+void inputRecorder::stop(const uint32_t frameCount) {
+    if (!_file) return;
+    put(frameCount);
+    put(END);
+    std::fclose(_file);
+    _file = nullptr;
+    _log.info("Recorded {} frames of input", frameCount);
+}
+
+inputReplay::~inputReplay() {
+    if (_file) std::fclose(_file);
+}
+
+bool inputReplay::open(const std::string& filePath) {
+    _file = std::fopen(filePath.c_str(), "rb");
+    if (!_file) {
+        _log.warn("Failed to open input recording: {}", filePath);
+        return false;
+    }
+    char magic[sizeof(MAGIC)];
+    uint8_t version = 0;
+    if (std::fread(magic, 1, sizeof(magic), _file) != sizeof(magic) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !get(version) || version != VERSION) {
+        _log.warn("Not a valid input recording: {}", filePath);
+        std::fclose(_file);
+        _file = nullptr;
+        return false;
+    }
+    _hasPending = readNext();
+    _log.info("Replaying input from {}", filePath);
+    return true;
+}
+
+bool inputReplay::readNext() {
+    uint8_t type = 0;
+    if (!get(_pendingFrame) || !get(type)) return false;
+    if (type == END) {
+        _frameCount = _pendingFrame;
+        return false;
+    }
+    _pendingIsFrame = type == FRAME;
+    if (_pendingIsFrame) return get(_pendingTicks);
+    _pending = {};
+    _pending.type = static_cast<inputEventType>(type);
+    switch (_pending.type) {
+        case inputEventType::KEY:
+        case inputEventType::MOUSE_BUTTON: {
+            int16_t code = 0;
+            uint8_t action = 0;
+            if (!get(code) || !get(action)) return false;
+            _pending.code = code;
+            _pending.action = action;
+            return true;
+        }
+        case inputEventType::MOUSE_MOVE:
+            return get(_pending.x) && get(_pending.y);
+        case inputEventType::MOUSE_WHEEL:
+            return get(_pending.y);
+        default:
+            return false;
+    }
+}
+
+timestep inputReplay::feed(const uint32_t frame) {
+    while (_hasPending && _pendingFrame <= frame) {
+        if (_pendingIsFrame) {
+            _frameTicks = _pendingTicks;
+            _hasPending = readNext();
+            continue;
+        }
+        switch (_pending.type) {
+            case inputEventType::KEY: input::onKeyEvent(_pending.code, _pending.action); break;
+            case inputEventType::MOUSE_BUTTON: input::onMouseButtonEvent(_pending.code, _pending.action); break;
+            case inputEventType::MOUSE_MOVE: input::onMouseMoveEvent(_pending.x, _pending.y); break;
+            case inputEventType::MOUSE_WHEEL: input::onMouseWheelEvent(_pending.y); break;
+        }
+        _hasPending = readNext();
+    }
+    // a recording cut short by a crash has no END entry, stop after its last event
+    if (!_hasPending && _frameCount == UINT32_MAX) {
+        _frameCount = frame + 1;
+    }
+    return timestep::fromTicks(_frameTicks);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "inputEventQueue.h"
+#include "core/timestep.h"
+#include "logging/logger.h"
+
+// file layout: "SKINPUT" + version byte, then entries that start with a u32 frame index and a u8 type
+//   FRAME: i64 ticks the frame advanced by, written once per frame ahead of its events
+//   inputEventType, then KEY/MOUSE_BUTTON: i16 code, u8 action   MOUSE_MOVE: f32 x, f32 y   MOUSE_WHEEL: f32 offset
+// an entry with type END and the total frame count closes the file
+
+// INPUT RECORDER - writes the input event stream of a session so it can be replayed frame for frame
+class inputRecorder {
+public:
+    ~inputRecorder();
+    bool start(const std::string& filePath);
+    // writes the frame's delta time and drains the input event queue into the file, call once per frame after polling events
+    void record(uint32_t frame, timestep deltaTime);
+    void stop(uint32_t frameCount);
+    [[nodiscard]] bool isRecording() const { return _file != nullptr; }
+private:
+    void write(uint32_t frame, const inputEvent& event);
+    template <typename T>
+    void put(const T& value) { std::fwrite(&value, sizeof(T), 1, _file); }
+
+    std::FILE* _file = nullptr;
+    static inline logger<LogCategory::INPUT> _log;
+};
+
+// INPUT REPLAY - feeds a recorded session back through input::on*Event, one recorded frame per call
+class inputReplay {
+public:
+    ~inputReplay();
+    bool open(const std::string& filePath);
+    // applies the frame's events and returns the delta time it was recorded with
+    timestep feed(uint32_t frame);
+    [[nodiscard]] bool isPlaying() const { return _file != nullptr; }
+    [[nodiscard]] bool finished(const uint32_t frame) const { return !_file || frame >= _frameCount; }
+private:
+    bool readNext();
+    template <typename T>
+    bool get(T& value) { return std::fread(&value, sizeof(T), 1, _file) == 1; }
+
+    std::FILE* _file = nullptr;
+    int64_t _frameTicks = 0;  //delta of the latest FRAME entry, a frame without one repeats it
+    uint32_t _frameCount = UINT32_MAX;  //known once the END entry is read
+    bool _hasPending = false;
+    uint32_t _pendingFrame = 0;
+    bool _pendingIsFrame = false;  //the pending entry is a FRAME delta rather than an event
+    int64_t _pendingTicks = 0;
+    inputEvent _pending;
+    static inline logger<LogCategory::INPUT> _log;
+};
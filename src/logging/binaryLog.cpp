@@ -0,0 +1,129 @@
+#include "binaryLog.h"
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+static constexpr char MAGIC[5] = { 'S', 'K', 'L', 'O', 'G' };
+static constexpr uint8_t VERSION = 3;
+
+static int64_t toNanoseconds(const std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+binaryFileSink::binaryFileSink(const std::string& filePath) {
+    _file = std::fopen(filePath.c_str(), "wb");
+    if (!_file) return;
+    std::setvbuf(_file, nullptr, _IOFBF, 1 << 16);
+    std::fwrite(MAGIC, 1, sizeof(MAGIC), _file);
+    put(VERSION);
+}
+
+binaryFileSink::~binaryFileSink() {
+    if (_file) std::fclose(_file);
+}
+
+uint32_t binaryFileSink::formatId(const logRecord& record) {
+    const auto key = std::make_pair(record.format.data(), record.argTypes);
+    if (const auto found = _formats.find(key); found != _formats.end()) {
+        return found->second;
+    }
+    const auto id = static_cast<uint32_t>(_formats.size());
+    _formats.emplace(key, id);
+    put(binaryLogEntry::FORMAT);
+    put(id);
+    put(static_cast<uint32_t>(record.format.size()));
+    std::fwrite(record.format.data(), 1, record.format.size(), _file);
+    put(record.argCount);
+    std::fwrite(record.argTypes, sizeof(logArgType), record.argCount, _file);
+    return id;
+}
+
+void binaryFileSink::write(const logRecord& record) {
+    if (!_file) return;
+    if (record.isDeferred()) {
+        const uint32_t id = formatId(record);
+        put(binaryLogEntry::DEFERRED);
+        put(static_cast<uint8_t>(record.level));
+        put(record.category);
+        put(toNanoseconds(record.time));
+        put(record.monotonicUs);
+        put(id);
+        put(record.length);
+        std::fwrite(record.text.data(), 1, record.length, _file);
+    } else {
+        const std::string_view message = record.message();
+        put(binaryLogEntry::TEXT);
+        put(static_cast<uint8_t>(record.level));
+        put(record.category);
+        put(toNanoseconds(record.time));
+        put(record.monotonicUs);
+        put(static_cast<uint32_t>(message.size()));
+        std::fwrite(message.data(), 1, message.size(), _file);
+    }
+}
+
+void binaryFileSink::flush() {
+    if (_file) std::fflush(_file);
+}
+
+bool readBinaryLog(const std::string& filePath, const std::function<void(const logRecord&)>& callback) {
+    std::FILE* file = std::fopen(filePath.c_str(), "rb");
+    if (!file) return false;
+    const auto get = [file](void* out, const size_t size) { return size == 0 || std::fread(out, size, 1, file) == 1; };
+
+    char magic[sizeof(MAGIC)];
+    uint8_t version = 0;
+    if (!get(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || !get(&version, 1) || version != VERSION) {
+        std::fclose(file);
+        return false;
+    }
+
+    struct formatEntry {
+        std::string format;
+        std::vector<logArgType> types;
+    };
+    std::unordered_map<uint32_t, formatEntry> formats;
+    std::vector<char> bytes;
+    binaryLogEntry entry;
+    bool valid = true;
+    while (valid && get(&entry, 1)) {
+        if (entry == binaryLogEntry::FORMAT) {
+            uint32_t id = 0, length = 0;
+            uint8_t argCount = 0;
+            formatEntry format;
+            valid = get(&id, 4) && get(&length, 4);
+            format.format.resize(valid ? length : 0);
+            valid = valid && get(format.format.data(), length) && get(&argCount, 1);
+            format.types.resize(valid ? argCount : 0);
+            valid = valid && get(format.types.data(), argCount);
+            formats[id] = std::move(format);
+            continue;
+        }
+        uint8_t level = 0;
+        LogCategory category = LogCategory::CORE;
+        int64_t nanoseconds = 0;
+        int64_t monotonicUs = -1;
+        uint32_t id = 0, length = 0;
+        valid = get(&level, 1) && get(&category, 1) && get(&nanoseconds, 8) && get(&monotonicUs, 8) && (entry != binaryLogEntry::DEFERRED || get(&id, 4)) && get(&length, 4);
+        bytes.resize(valid ? length : 0);
+        valid = valid && get(bytes.data(), length);
+        if (!valid) break;
+
+        logRecord record;
+        record.level = static_cast<LogLevel>(level);
+        record.category = category;
+        record.monotonicUs = monotonicUs;
+        record.time = std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanoseconds)));
+        if (entry == binaryLogEntry::DEFERRED) {
+            const auto format = formats.find(id);
+            record.overflow = format == formats.end()
+                ? std::string("<unknown format>")
+                : logArgs::formatRuntime(format->second.format, format->second.types, bytes.data());
+        } else {
+            record.overflow.assign(bytes.data(), bytes.size());
+        }
+        callback(record);
+    }
+    std::fclose(file);
+    return valid;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include "logSink.h"
+
+// file layout: "SKLOG" + version byte, then a stream of entries each starting with a binaryLogEntry byte
+//   FORMAT:   u32 id, u32 length, format bytes, u8 argument count, one logArgType byte per argument
+//   DEFERRED: u8 level, u8 category, i64 nanoseconds since epoch, i64 monotonic microseconds, u32 format id, u32 length, raw argument bytes
+//   TEXT:     u8 level, u8 category, i64 nanoseconds since epoch, i64 monotonic microseconds, u32 length, message bytes
+enum class binaryLogEntry : uint8_t {
+    FORMAT = 1,
+    DEFERRED = 2,
+    TEXT = 3
+};
+
+// BINARY FILE SINK - writes deferred records without formatting them, each format string is stored once
+class binaryFileSink : public logSink {
+public:
+    explicit binaryFileSink(const std::string& filePath);
+    ~binaryFileSink() override;
+    void write(const logRecord& record) override;
+    void flush() override;
+private:
+    uint32_t formatId(const logRecord& record);
+    template <typename T>
+    void put(const T& value) { std::fwrite(&value, sizeof(T), 1, _file); }
+
+    std::FILE* _file = nullptr;
+    std::map<std::pair<const char*, const logArgType*>, uint32_t> _formats;
+};
+
+// reads a binary log back, every record is handed over fully formatted
+bool readBinaryLog(const std::string& filePath, const std::function<void(const logRecord&)>& callback);
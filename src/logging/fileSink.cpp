@@ -0,0 +1,96 @@
+#include "fileSink.h"
+#include <filesystem>
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+fileSink::fileSink(std::string filePath, const fileSinkSettings settings)
+    : _filePath(std::move(filePath)), _settings(settings) {
+    _buffer.reserve(_settings.bufferSize);
+    open();
+}
+
+fileSink::~fileSink() {
+    writeBuffer();
+    if (_file) std::fclose(_file);
+}
+
+bool fileSink::open() {
+    _file = std::fopen(_filePath.c_str(), "ab");
+    if (!_file) return false;
+    // the sink does its own batching, stdio buffering would only copy everything twice
+    std::setvbuf(_file, nullptr, _IONBF, 0);
+    std::error_code error;
+    const auto size = std::filesystem::file_size(_filePath, error);
+    _fileBytes = error ? 0 : static_cast<size_t>(size);
+    _openedAt = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool fileSink::needsRotation(const size_t incoming) const {
+    const size_t size = _fileBytes + _buffer.size();
+    if (size == 0) return false;
+    if (_settings.maxBytes && size + incoming > _settings.maxBytes) return true;
+    return _settings.maxAge.count() && std::chrono::steady_clock::now() - _openedAt >= _settings.maxAge;
+}
+
+// <path> becomes <path>.1, older files shift up by one and the oldest is removed
+void fileSink::rotate() {
+    writeBuffer();
+    if (_file) {
+        std::fclose(_file);
+        _file = nullptr;
+    }
+    std::error_code error;
+    if (_settings.keepFiles > 0) {
+        std::filesystem::remove(_filePath + "." + std::to_string(_settings.keepFiles), error);
+        for (int i = _settings.keepFiles - 1; i >= 1; i--) {
+            std::filesystem::rename(_filePath + "." + std::to_string(i), _filePath + "." + std::to_string(i + 1), error);
+        }
+        std::filesystem::rename(_filePath, _filePath + ".1", error);
+    } else {
+        std::filesystem::remove(_filePath, error);
+    }
+    open();
+}
+
+void fileSink::write(const logRecord& record) {
+    _line.clear();
+    consoleSink::appendPrefix(_line, record);
+    _line += record.message();
+    _line += '\n';
+
+    if (needsRotation(_line.size())) {
+        rotate();
+    }
+    _buffer += _line;
+    if (record.level == LogLevel::FAIL) {
+        sync();
+    } else if (_buffer.size() >= _settings.bufferSize) {
+        writeBuffer();
+    }
+}
+
+void fileSink::writeBuffer() {
+    if (!_file || _buffer.empty()) return;
+    _fileBytes += std::fwrite(_buffer.data(), 1, _buffer.size(), _file);
+    _buffer.clear();
+}
+
+void fileSink::flush() {
+    writeBuffer();
+}
+
+// pushes everything to the disk, not just the OS cache, so the error survives a crash or power loss
+void fileSink::sync() {
+    writeBuffer();
+    if (!_file) return;
+    std::fflush(_file);
+#if defined(_WIN32)
+    _commit(_fileno(_file));
+#else
+    fsync(fileno(_file));
+#endif
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "logSink.h"
+
+struct fileSinkSettings {
+    size_t maxBytes = 16 * 1024 * 1024;   //rotate before the file grows past this, 0 disables
+    std::chrono::minutes maxAge{24 * 60};  //rotate once the file has been open this long, 0 disables
+    int keepFiles = 5;                     //rotated files are kept as <path>.1 (newest) to <path>.<keepFiles>
+    size_t bufferSize = 64 * 1024;         //text is held until this much is pending or the backend flushes
+};
+
+// FILE SINK - plain text log file with size and age based rotation, errors are synced to disk immediately
+class fileSink : public logSink {
+public:
+    explicit fileSink(std::string filePath, fileSinkSettings settings = {});
+    ~fileSink() override;
+    void write(const logRecord& record) override;
+    void flush() override;
+    void sync() override;
+    [[nodiscard]] bool isOpen() const { return _file != nullptr; }
+private:
+    bool open();
+    void rotate();
+    void writeBuffer();
+    [[nodiscard]] bool needsRotation(size_t incoming) const;
+
+    std::string _filePath;
+    fileSinkSettings _settings;
+    std::FILE* _file = nullptr;
+    std::string _buffer;
+    std::string _line;  //reused so formatting a line does not allocate once it has grown
+    size_t _fileBytes = 0;
+    std::chrono::steady_clock::time_point _openedAt;
+};
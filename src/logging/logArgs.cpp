@@ -0,0 +1,45 @@
+#include "logArgs.h"
+#include <array>
+#include <utility>
+
+namespace logArgs {
+    template <size_t Count>
+    static std::string formatValues(const std::string_view format, value* values) {
+        return [&]<size_t... I>(std::index_sequence<I...>) {
+            return std::vformat(format, std::make_format_args(values[I]...));
+        }(std::make_index_sequence<Count>{});
+    }
+
+    // one entry per argument count, the format arguments have to be a compile time pack
+    static constexpr auto formatters = []<size_t... Count>(std::index_sequence<Count...>) {
+        return std::array{ &formatValues<Count>... };
+    }(std::make_index_sequence<MAX_ARGS + 1>{});
+
+    std::string formatRuntime(const std::string_view format, const std::span<const logArgType> types, const char* bytes) {
+        if (types.size() > MAX_ARGS) {
+            return std::format("{} <too many arguments>", format);
+        }
+        value values[MAX_ARGS];
+        const char* cursor = bytes;
+        for (size_t i = 0; i < types.size(); i++) {
+            switch (types[i]) {
+                case logArgType::BOOL: values[i].data = read<bool>(cursor); break;
+                case logArgType::CHAR: values[i].data = read<char>(cursor); break;
+                case logArgType::INT32: values[i].data = read<int32_t>(cursor); break;
+                case logArgType::UINT32: values[i].data = read<uint32_t>(cursor); break;
+                case logArgType::INT64: values[i].data = read<int64_t>(cursor); break;
+                case logArgType::UINT64: values[i].data = read<uint64_t>(cursor); break;
+                case logArgType::FLOAT: values[i].data = read<float>(cursor); break;
+                case logArgType::DOUBLE: values[i].data = read<double>(cursor); break;
+                case logArgType::STRING: values[i].data = read<std::string_view>(cursor); break;
+                case logArgType::POINTER: values[i].data = read<const void*>(cursor); break;
+            }
+        }
+        try {
+            return formatters[types.size()](format, values);
+        } catch (const std::format_error& e) {
+            // dynamic width and precision need the real integer type, which type erasure hides
+            return std::format("{} <{}>", format, e.what());
+        }
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+// LOG ARGS - raw argument encoding for deferred formatting, the caller copies argument bytes
+// and the consumer (or the offline decoder) rebuilds the values and formats them later
+
+enum class logArgType : uint8_t {
+    BOOL,
+    CHAR,
+    INT32,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    STRING,   //length prefixed, copied at the call site
+    POINTER
+};
+
+namespace logArgs {
+    static constexpr size_t MAX_ARGS = 16;
+
+    template <typename T>
+    constexpr bool isString = std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+                              std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+                              (std::is_array_v<T> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<T>>, char>);
+
+    // UNSUPPORTED_TYPE for anything that needs its own formatter, those messages are formatted eagerly
+    template <typename T>
+    constexpr int typeOf() {
+        using U = std::remove_cvref_t<T>;
+        if constexpr (std::is_same_v<U, bool>) return static_cast<int>(logArgType::BOOL);
+        else if constexpr (std::is_same_v<U, char>) return static_cast<int>(logArgType::CHAR);
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) <= 4) return static_cast<int>(logArgType::INT32);
+        else if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U> && sizeof(U) <= 4) return static_cast<int>(logArgType::UINT32);
+        else if constexpr (std::is_integral_v<U> && std::is_signed_v<U> && sizeof(U) == 8) return static_cast<int>(logArgType::INT64);
+        else if constexpr (std::is_integral_v<U> && std::is_unsigned_v<U> && sizeof(U) == 8) return static_cast<int>(logArgType::UINT64);
+        else if constexpr (std::is_same_v<U, float>) return static_cast<int>(logArgType::FLOAT);
+        else if constexpr (std::is_same_v<U, double>) return static_cast<int>(logArgType::DOUBLE);
+        else if constexpr (isString<U>) return static_cast<int>(logArgType::STRING);
+        else if constexpr (std::is_same_v<U, void*> || std::is_same_v<U, const void*>) return static_cast<int>(logArgType::POINTER);
+        else return -1;
+    }
+
+    template <typename... Args>
+    constexpr bool deferrable = sizeof...(Args) <= MAX_ARGS && ((typeOf<Args>() >= 0) && ...);
+
+    template <typename... Args>
+    inline constexpr logArgType types[sizeof...(Args) + 1] = { static_cast<logArgType>(typeOf<Args>())... };
+
+    // the type each argument is rebuilt as, formatting it gives the same text as the original
+    template <logArgType Type> struct storage;
+    template <> struct storage<logArgType::BOOL> { using type = bool; };
+    template <> struct storage<logArgType::CHAR> { using type = char; };
+    template <> struct storage<logArgType::INT32> { using type = int32_t; };
+    template <> struct storage<logArgType::UINT32> { using type = uint32_t; };
+    template <> struct storage<logArgType::INT64> { using type = int64_t; };
+    template <> struct storage<logArgType::UINT64> { using type = uint64_t; };
+    template <> struct storage<logArgType::FLOAT> { using type = float; };
+    template <> struct storage<logArgType::DOUBLE> { using type = double; };
+    template <> struct storage<logArgType::STRING> { using type = std::string_view; };
+    template <> struct storage<logArgType::POINTER> { using type = const void*; };
+    template <typename T>
+    using storageOf = typename storage<static_cast<logArgType>(typeOf<T>())>::type;
+
+    template <typename T>
+    bool encodeOne(char* out, const size_t capacity, size_t& used, const T& value) {
+        if constexpr (typeOf<T>() == static_cast<int>(logArgType::STRING)) {
+            const std::string_view text(value);
+            const auto length = static_cast<uint32_t>(text.size());
+            if (used + sizeof(length) + length > capacity) return false;
+            std::memcpy(out + used, &length, sizeof(length));
+            std::memcpy(out + used + sizeof(length), text.data(), length);
+            used += sizeof(length) + length;
+        } else {
+            const storageOf<T> stored = static_cast<storageOf<T>>(value);
+            if (used + sizeof(stored) > capacity) return false;
+            std::memcpy(out + used, &stored, sizeof(stored));
+            used += sizeof(stored);
+        }
+        return true;
+    }
+
+    // returns false if the arguments do not fit, the caller then formats eagerly
+    template <typename... Args>
+    bool encode([[maybe_unused]] char* out, [[maybe_unused]] const size_t capacity, size_t& used, const Args&... args) {
+        used = 0;
+        return (encodeOne(out, capacity, used, args) && ...);
+    }
+
+    template <typename T>
+    T read(const char*& cursor) {
+        if constexpr (std::is_same_v<T, std::string_view>) {
+            uint32_t length;
+            std::memcpy(&length, cursor, sizeof(length));
+            const std::string_view text(cursor + sizeof(length), length);
+            cursor += sizeof(length) + length;
+            return text;
+        } else {
+            T value;
+            std::memcpy(&value, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return value;
+        }
+    }
+
+    // instantiated per call site, so the consumer formats with the exact argument types the caller used
+    template <typename... Args>
+    void decode(std::string& out, const std::string_view format, const char* bytes) {
+        [[maybe_unused]] const char* cursor = bytes;  //untouched when there are no arguments
+        std::tuple<storageOf<Args>...> values{ read<storageOf<Args>>(cursor)... };
+        std::apply([&](auto&... value) { out = std::vformat(format, std::make_format_args(value...)); }, values);
+    }
+
+    // type erased argument for the offline decoder, which only has the type tags
+    struct value {
+        std::variant<bool, char, int32_t, uint32_t, int64_t, uint64_t, float, double, std::string_view, const void*> data;
+    };
+
+    std::string formatRuntime(std::string_view format, std::span<const logArgType> types, const char* bytes);
+}
+
+// forwards the replacement field spec to the formatter of the held type
+template <>
+struct std::formatter<logArgs::value> {
+    std::string_view spec;
+
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto end = ctx.begin();
+        while (end != ctx.end() && *end != '}') ++end;
+        spec = std::string_view(ctx.begin(), end);
+        return end;
+    }
+
+    auto format(const logArgs::value& arg, std::format_context& ctx) const {
+        return std::visit([&](const auto& held) {
+            std::formatter<std::remove_cvref_t<decltype(held)>> inner;
+            std::format_parse_context specContext(spec);
+            inner.parse(specContext);
+            return inner.format(held, ctx);
+        }, arg.data);
+    }
+};
@@ -0,0 +1,208 @@
+#include "logBackend.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+void logBackend::ensureDefaultSinks() {
+    if (_defaultSinks && _sinks.empty()) {
+        _sinks.push_back(std::make_shared<consoleSink>());
+    }
+}
+
+void logBackend::setLevel(const LogLevel level) {
+    for (auto& categoryLevel : _levels) {
+        categoryLevel.store(level, std::memory_order_relaxed);
+    }
+}
+
+void logBackend::addSink(std::shared_ptr<logSink> sink) {
+    std::lock_guard lock(_sinkMutex);
+    ensureDefaultSinks();
+    _sinks.push_back(std::move(sink));
+}
+
+void logBackend::clearSinks() {
+    flush();
+    std::lock_guard lock(_sinkMutex);
+    _sinks.clear();
+    _defaultSinks = false;
+}
+
+void logBackend::writeToSinks(const logRecord& record) {
+    for (const auto& sink : _sinks) {
+        sink->write(record);
+    }
+}
+
+void logBackend::flushSinks() {
+    for (const auto& sink : _sinks) {
+        sink->flush();
+    }
+}
+
+void logBackend::submit(logRecord&& record) {
+    if (isAsync()) {
+        _submitted.fetch_add(1, std::memory_order_relaxed);
+        // a full queue means the sinks are behind, wait for room rather than drop the message
+        while (!_queue->tryPush(std::move(record))) {
+            std::this_thread::yield();
+        }
+        return;
+    }
+    // encoded while the backend was still async, e.g. racing stopAsync, so it has to be formatted here
+    record.resolve();
+    std::lock_guard lock(_sinkMutex);
+    ensureDefaultSinks();
+    writeToSinks(record);
+    flushSinks();
+}
+
+void logBackend::flush() {
+    if (isAsync()) {
+        const uint64_t target = _submitted.load(std::memory_order_relaxed);
+        while (_written.load(std::memory_order_acquire) < target) {
+            std::this_thread::yield();
+        }
+        return;
+    }
+    std::lock_guard lock(_sinkMutex);
+    flushSinks();
+}
+
+size_t logBackend::drain() {
+    std::lock_guard lock(_sinkMutex);
+    ensureDefaultSinks();
+    logRecord record;
+    size_t count = 0;
+    while (count < BATCH_SIZE && _queue->tryPop(record)) {
+        record.resolve();
+        writeToSinks(record);
+        count++;
+    }
+    if (count) {
+        flushSinks();
+        _written.fetch_add(count, std::memory_order_release);
+    }
+    return count;
+}
+
+void logBackend::workerLoop() {
+    while (_running.load(std::memory_order_relaxed)) {
+        if (!drain()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    while (drain()) {}
+}
+
+void logBackend::startAsync() {
+    if (isAsync()) return;
+    if (!_queue) {
+        _queue = std::make_unique<mpscQueue<logRecord, QUEUE_SIZE>>();
+    }
+    _running.store(true, std::memory_order_relaxed);
+    _worker = std::thread(workerLoop);
+    _async.store(true, std::memory_order_release);
+}
+
+// call once other threads have stopped logging, the queue is drained before returning
+void logBackend::stopAsync() {
+    // only the caller that turns async off joins the worker
+    if (!_async.exchange(false, std::memory_order_acq_rel)) return;
+    _running.store(false, std::memory_order_relaxed);
+    _worker.join();
+}
+
+bool logBackend::shouldPromptOnFatal() {
+    switch (_fatalMode.load(std::memory_order_relaxed)) {
+        case FatalMode::PROMPT: return true;
+        case FatalMode::EXIT: return false;
+        default:
+#if defined(_WIN32)
+            return _isatty(_fileno(stdin)) != 0;
+#else
+            return isatty(fileno(stdin)) != 0;
+#endif
+    }
+}
+
+// none of this is async-signal-safe, the process is going down either way and a best effort log beats none
+void logBackend::crashFlush() {
+    // the worker may be mid-batch, give it a moment to let go of the sinks
+    bool locked = false;
+    for (int attempt = 0; attempt < 1000 && !locked; attempt++) {
+        locked = _sinkMutex.try_lock();
+        if (!locked) std::this_thread::yield();
+    }
+    if (!locked) return;
+    if (_queue) {
+        logRecord record;
+        while (_queue->tryPop(record)) {
+            record.resolve();
+            writeToSinks(record);
+        }
+    }
+    for (const auto& sink : _sinks) {
+        sink->sync();
+    }
+    _sinkMutex.unlock();
+}
+
+static void onFatalSignal(const int signal) {
+    logBackend::crashFlush();
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+void logBackend::addFatalHook(void (*hook)()) {
+    std::lock_guard lock(_hookMutex);
+    if (std::ranges::find(_fatalHooks, hook) == _fatalHooks.end()) {
+        _fatalHooks.push_back(hook);
+    }
+}
+
+void logBackend::runFatalHooks() {
+    // taken out first so an error raised inside a hook does not run the hooks again
+    std::vector<void (*)()> hooks;
+    {
+        std::lock_guard lock(_hookMutex);
+        hooks.swap(_fatalHooks);
+    }
+    for (auto hook = hooks.rbegin(); hook != hooks.rend(); ++hook) {
+        (*hook)();
+    }
+}
+
+void logBackend::enterFatal() {
+    const std::thread::id self = std::this_thread::get_id();
+    std::thread::id first;
+    if (_fatalThread.compare_exchange_strong(first, self) || first == self) return;
+    {
+        std::lock_guard lock(_hookMutex);
+        _parkedThreads.push_back(self);
+    }
+    // its message is already submitted, the failing thread writes it out before exiting
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+}
+
+bool logBackend::isParkedInFatal(const std::thread::id thread) {
+    std::lock_guard lock(_hookMutex);
+    return std::ranges::find(_parkedThreads, thread) != _parkedThreads.end();
+}
+
+void logBackend::installCrashHandler() {
+    for (const int signal : { SIGSEGV, SIGABRT, SIGFPE, SIGILL }) {
+        std::signal(signal, onFatalSignal);
+    }
+#if defined(SIGBUS)
+    std::signal(SIGBUS, onFatalSignal);
+#endif
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "core/mpscQueue.h"
+#include "logSink.h"
+
+// what an error does once it has been written, AUTO only prompts when stdin is an interactive terminal
+enum class FatalMode {
+    AUTO,
+    PROMPT,
+    EXIT
+};
+
+// LOG BACKEND - hands records to the sinks, either inline on the calling thread or through a
+// lock-free queue drained in batches by a background thread so callers never wait on terminal or disk I/O
+class logBackend {
+public:
+    static void submit(logRecord&& record);
+    static void flush();
+    static void startAsync();
+    static void stopAsync();
+    [[nodiscard]] static bool isAsync() { return _async.load(std::memory_order_relaxed); }
+    // with deferred formatting on, async records carry raw arguments and are formatted on the worker
+    static void setDeferredFormatting(bool enabled) { _deferred.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] static bool isDeferred() { return isAsync() && _deferred.load(std::memory_order_relaxed); }
+    // runtime minimum level per category, checked by the logger before anything is formatted
+    static void setLevel(LogCategory category, LogLevel level) { _levels[static_cast<size_t>(category)].store(level, std::memory_order_relaxed); }
+    static void setLevel(LogLevel level);
+    [[nodiscard]] static LogLevel getLevel(const LogCategory category) { return _levels[static_cast<size_t>(category)].load(std::memory_order_relaxed); }
+    // adds microseconds since epoch() to every record, the CPU profiler measures from the same epoch
+    static void setMonotonicTimestamps(const bool enabled) { _monotonic.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] static bool hasMonotonicTimestamps() { return _monotonic.load(std::memory_order_relaxed); }
+    [[nodiscard]] static std::chrono::steady_clock::time_point epoch() { return _epoch; }
+    static void setFatalMode(const FatalMode mode) { _fatalMode.store(mode, std::memory_order_relaxed); }
+    [[nodiscard]] static bool shouldPromptOnFatal();
+    // writes out whatever is queued and syncs every sink when the process receives a fatal signal
+    static void installCrashHandler();
+    static void crashFlush();
+    static void addSink(std::shared_ptr<logSink> sink);
+    static void clearSinks();
+    // run once by a fatal error before the worker stops, newest first, subsystems owning threads stop them here
+    // so exit() never destroys a joinable std::thread, adding the same hook twice keeps one entry
+    static void addFatalHook(void (*hook)());
+    static void runFatalHooks();
+    // returns for the first thread to fail (and again for that thread), any other thread is parked here
+    // for good so only one of them runs the hooks and exits
+    static void enterFatal();
+    [[nodiscard]] static bool isParkedInFatal(std::thread::id thread);
+private:
+    static constexpr size_t QUEUE_SIZE = 4096;
+    static constexpr size_t BATCH_SIZE = 256;
+
+    static void ensureDefaultSinks();
+    static void writeToSinks(const logRecord& record);
+    static void flushSinks();
+    static size_t drain();
+    static void workerLoop();
+
+    static inline std::mutex _sinkMutex;
+    static inline std::vector<std::shared_ptr<logSink>> _sinks;
+    static inline bool _defaultSinks = true;  //console sink is added lazily unless sinks were configured
+    static inline std::unique_ptr<mpscQueue<logRecord, QUEUE_SIZE>> _queue;
+    static inline std::thread _worker;
+    static inline std::atomic<bool> _async = false;
+    static inline std::atomic<bool> _running = false;
+    static inline std::atomic<bool> _deferred = true;
+    static inline std::atomic<bool> _monotonic = false;
+    static inline const std::chrono::steady_clock::time_point _epoch = std::chrono::steady_clock::now();
+    static inline std::atomic<FatalMode> _fatalMode = FatalMode::AUTO;
+    static inline std::atomic<LogLevel> _levels[static_cast<size_t>(LogCategory::COUNT)] = {};
+    static inline std::atomic<uint64_t> _submitted = 0;
+    static inline std::atomic<uint64_t> _written = 0;
+    static inline std::mutex _hookMutex;
+    static inline std::vector<void (*)()> _fatalHooks;
+    static inline std::atomic<std::thread::id> _fatalThread;
+    static inline std::vector<std::thread::id> _parkedThreads;  //guarded by _hookMutex
+};
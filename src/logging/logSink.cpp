@@ -0,0 +1,106 @@
+#include "logSink.h"
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#if defined(_WIN32)
+    #include <windows.h>
+#endif
+
+consoleSink::consoleSink() {
+    enableAnsiColors();
+}
+
+void consoleSink::enableAnsiColors() {
+#if defined(_WIN32)
+    const HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+#endif
+}
+
+std::string_view consoleSink::tag(const LogLevel level) {
+    switch (level) {
+        case LogLevel::TEST: return " [TEST] ";
+        case LogLevel::INFO: return " [INFO] ";
+        case LogLevel::WARN: return " [WARN] ";
+        case LogLevel::FAIL: return " [FAIL] ";
+        default: return "";
+    }
+}
+
+// core is the default channel and stays untagged
+std::string_view consoleSink::tag(const LogCategory category) {
+    switch (category) {
+        case LogCategory::RENDER: return "[RENDER] ";
+        case LogCategory::INPUT: return "[INPUT] ";
+        case LogCategory::ASSET: return "[ASSET] ";
+        default: return "";
+    }
+}
+
+std::string_view consoleSink::color(const LogLevel level) {
+    switch (level) {
+        case LogLevel::TEST: return "\033[38;2;178;235;148m";      // Green
+        case LogLevel::INFO: return "\033[38;2;210;210;210m";      // Gray
+        case LogLevel::WARN: return "\033[38;2;255;255;150m";      // Yellow
+        case LogLevel::FAIL: return "\033[38;2;255;110;110m";      // Red
+        default: return "\033[48;2;150;150;150m\033[38;2;0;0;0m";  // Black
+    }
+}
+
+// only re-rendered when the second changes, the view stays valid until the next call on the same thread
+std::string_view consoleSink::timestamp(const std::chrono::system_clock::time_point time) {
+    thread_local std::time_t cachedSecond = -1;
+    thread_local char cached[16] = {};
+    thread_local size_t length = 0;
+    const std::time_t second = std::chrono::system_clock::to_time_t(time);
+    if (second != cachedSecond) {
+        std::tm localTime{};
+#if defined(_WIN32)
+        localtime_s(&localTime, &second);
+#else
+        localtime_r(&second, &localTime);
+#endif
+        length = std::strftime(cached, sizeof(cached), "[%H:%M:%S]", &localTime);
+        cachedSecond = second;
+    }
+    return { cached, length };
+}
+
+void consoleSink::appendPrefix(std::string& out, const logRecord& record) {
+    if (record.level == LogLevel::SPECIAL) return;
+    out += timestamp(record.time);
+    if (record.monotonicUs >= 0) {
+        char monotonic[32];
+        const int length = std::snprintf(monotonic, sizeof(monotonic), " [%" PRId64 ".%06" PRId64 "]",
+                                         record.monotonicUs / 1'000'000, record.monotonicUs % 1'000'000);
+        out.append(monotonic, static_cast<size_t>(length));
+    }
+    out += tag(record.level);
+    out += tag(record.category);
+}
+
+void consoleSink::write(const logRecord& record) {
+    // failures skip the batch so they are on screen before the engine goes down
+    if (record.level == LogLevel::FAIL) {
+        flush();
+    }
+    _buffer += color(record.level);
+    appendPrefix(_buffer, record);
+    _buffer += record.message();
+    _buffer += "\033[0m\n";
+    if (record.level == LogLevel::FAIL) {
+        std::fwrite(_buffer.data(), 1, _buffer.size(), stderr);
+        std::fflush(stderr);
+        _buffer.clear();
+    }
+}
+
+void consoleSink::flush() {
+    if (_buffer.empty()) return;
+    std::fwrite(_buffer.data(), 1, _buffer.size(), stdout);
+    std::fflush(stdout);
+    _buffer.clear();
+}
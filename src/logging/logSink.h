@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include "logArgs.h"
+
+enum class LogLevel {
+    TEST,
+    INFO,
+    WARN,
+    FAIL,
+    SPECIAL
+};
+
+// named channels so each subsystem can be filtered on its own
+enum class LogCategory : uint8_t {
+    CORE,
+    RENDER,
+    INPUT,
+    ASSET,
+    COUNT
+};
+
+using logDecodeFunction = void (*)(std::string& out, std::string_view format, const char* args);
+
+// a single message, short messages live inline so queueing them never allocates
+// deferred records hold raw argument bytes in text and are formatted by the consumer through decode
+struct logRecord {
+    static constexpr size_t INLINE_SIZE = 256;
+
+    LogLevel level = LogLevel::INFO;
+    LogCategory category = LogCategory::CORE;
+    std::chrono::system_clock::time_point time;
+    int64_t monotonicUs = -1;  //microseconds since logBackend::epoch(), only recorded when monotonic timestamps are on
+    uint32_t length = 0;
+    std::array<char, INLINE_SIZE> text;
+    std::string overflow;  //formatted text that does not fit inline, or the result of a deferred record
+
+    std::string_view format;                //deferred only, points at the format string literal
+    logDecodeFunction decode = nullptr;     //deferred only
+    const logArgType* argTypes = nullptr;   //deferred only, used by the binary sink
+    uint8_t argCount = 0;
+
+    [[nodiscard]] bool isDeferred() const { return decode != nullptr; }
+
+    // formats a deferred record, called once on the consumer before the sinks see it
+    void resolve() {
+        if (isDeferred() && overflow.empty()) {
+            decode(overflow, format, text.data());
+        }
+    }
+
+    [[nodiscard]] std::string_view message() const {
+        return isDeferred() || !overflow.empty() ? std::string_view(overflow) : std::string_view(text.data(), length);
+    }
+};
+
+// LOG SINK - destination for log records, only ever called from one thread at a time
+class logSink {
+public:
+    virtual ~logSink() = default;
+    virtual void write(const logRecord& record) = 0;
+    virtual void flush() = 0;
+    // forces flushed output onto stable storage, called for errors and from the crash handler
+    virtual void sync() { flush(); }
+};
+
+// CONSOLE SINK - colored output to stdout, failures go to stderr, lines are batched until flush
+class consoleSink : public logSink {
+public:
+    consoleSink();
+    void write(const logRecord& record) override;
+    void flush() override;
+    static std::string_view tag(LogLevel level);
+    static std::string_view tag(LogCategory category);
+    static std::string_view timestamp(std::chrono::system_clock::time_point time);
+    // timestamp and tags in front of the message, shared by the text sinks
+    static void appendPrefix(std::string& out, const logRecord& record);
+private:
+    static void enableAnsiColors();
+    static std::string_view color(LogLevel level);
+    std::string _buffer;
+};
@@ -1,114 +1,146 @@
-#pragma once
-#include <iostream>
-#include <string>
-#include <ctime>
-#include <iomanip>
-#include <sstream>
-#include <format>
-#if defined(_WIN32)
-    #include <windows.h>
-#endif
-
-enum class LogLevel {
-    TEST,
-    INFO,
-    WARN,
-    FAIL,
-    SPECIAL
-};
-
-class logger {
-private:
-    static void enableAnsiColors() {
-#if defined(_WIN32)
-        const HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-        DWORD dwMode = 0;
-        GetConsoleMode(hOut, &dwMode);
-        dwMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-        SetConsoleMode(hOut, dwMode);
-#endif
-    }
-
-    static std::string tag(const LogLevel level) {
-        switch (level) {
-            case LogLevel::TEST: return " [TEST] ";
-            case LogLevel::INFO: return " [INFO] ";
-            case LogLevel::WARN: return " [WARN] ";
-            case LogLevel::FAIL: return " [FAIL] ";
-            default: return "";
-        }
-    }
-
-    static void setColor(const LogLevel level) {
-        switch (level) {
-            case LogLevel::TEST: std::cout << "\033[38;2;178;235;148m"; break;      // Green
-            case LogLevel::INFO: std::cout << "\033[38;2;210;210;210m"; break;      // Gray
-            case LogLevel::WARN: std::cout << "\033[38;2;255;255;150m"; break;      // Yellow
-            case LogLevel::FAIL: std::cout << "\033[38;2;255;110;110m"; break;      // Red
-            default: std::cout << "\033[48;2;150;150;150m\033[38;2;0;0;0m"; break;  // Black
-        }
-    }
-
-    static void resetColor() {
-        std::cout << "\033[0m";
-    }
-
-    static std::string timestamp() {
-        const std::time_t now = std::time(nullptr);
-        std::tm localTime{};
-        localtime_s(&localTime, &now);
-        std::ostringstream oss;
-        oss << std::put_time(&localTime, "[%H:%M:%S]");
-        return oss.str();
-    }
-
-    static void print(LogLevel level, const std::string& message) {
-        setColor(level);
-        if (level == LogLevel::FAIL) {
-            std::cerr << timestamp() << tag(level) << message << std::endl;
-            resetColor();
-            std::cout << "Engine Shutting Down. Press Enter to Exit...\n";
-            std::cin.get();
-            exit(1);
-        }
-        if (level != LogLevel::SPECIAL) {
-            std::cout << timestamp() << tag(level) << message << std::endl;
-        } else {
-            std::cout << message << std::endl;
-        }
-        resetColor();
-    }
-public:
-    logger() {
-        enableAnsiColors();
-    }
-    void init() {
-        log("  ---[[WELCOME TO SKETCH ENGINE!]]---  ");
-    }
-
-#ifdef SKETCH_DEBUG
-    template <typename... Args>
-    void debug(std::format_string<Args...> fmt, Args&&... args) {
-        print(LogLevel::TEST, std::format(fmt, std::forward<Args>(args)...));
-    }
-#else
-    template <typename... Args>
-    void debug(std::format_string<Args...> fmt, Args&&... args) {} // stripped in release
-#endif
-    template <typename... Args>
-    void info(std::format_string<Args...> fmt, Args&&... args) {
-        print(LogLevel::INFO, std::format(fmt, std::forward<Args>(args)...));
-    }
-    template <typename... Args>
-    void warn(std::format_string<Args...> fmt, Args&&... args) {
-        print(LogLevel::WARN, std::format(fmt, std::forward<Args>(args)...));
-    }
-    template <typename... Args>
-    void error(std::format_string<Args...> fmt, Args&&... args) {
-        print(LogLevel::FAIL, std::format(fmt, std::forward<Args>(args)...));
-    }
-    template <typename... Args>
-    void log(std::format_string<Args...> fmt, Args&&... args) {
-        print(LogLevel::SPECIAL, std::format(fmt, std::forward<Args>(args)...));
-    }
-};
\ No newline at end of file
+#pragma once
+#include <iostream>
+#include <string>
+#include <format>
+#include <type_traits>
+#include "logBackend.h"
+#include "profiling/memoryTracker.h"
+
+// compile time minimum level, calls below it are removed entirely: 0 debug, 1 info, 2 warn, 3 errors only
+// SKETCH_LOG_LEVEL sets every category, SKETCH_LOG_LEVEL_<CATEGORY> overrides a single one
+#ifndef SKETCH_LOG_LEVEL
+    #ifdef SKETCH_DEBUG
+        #define SKETCH_LOG_LEVEL 0
+    #else
+        #define SKETCH_LOG_LEVEL 1
+    #endif
+#endif
+#ifndef SKETCH_LOG_LEVEL_CORE
+    #define SKETCH_LOG_LEVEL_CORE SKETCH_LOG_LEVEL
+#endif
+#ifndef SKETCH_LOG_LEVEL_RENDER
+    #define SKETCH_LOG_LEVEL_RENDER SKETCH_LOG_LEVEL
+#endif
+#ifndef SKETCH_LOG_LEVEL_INPUT
+    #define SKETCH_LOG_LEVEL_INPUT SKETCH_LOG_LEVEL
+#endif
+#ifndef SKETCH_LOG_LEVEL_ASSET
+    #define SKETCH_LOG_LEVEL_ASSET SKETCH_LOG_LEVEL
+#endif
+
+// the logger methods skip formatting for filtered levels, but their arguments are still evaluated
+// the macros also skip argument evaluation, use them where building the arguments costs something
+#define SKETCH_LOG_AT(log, level, method, ...)                                  \
+    do {                                                                        \
+        using sketchLoggerType = std::remove_cvref_t<decltype(log)>;            \
+        if constexpr (sketchLoggerType::compiledIn(level)) {                    \
+            if (sketchLoggerType::isEnabled(level)) (log).method(__VA_ARGS__);  \
+        }                                                                       \
+    } while (0)
+#define SKETCH_LOG_DEBUG(log, ...) SKETCH_LOG_AT(log, LogLevel::TEST, debug, __VA_ARGS__)
+#define SKETCH_LOG_INFO(log, ...) SKETCH_LOG_AT(log, LogLevel::INFO, info, __VA_ARGS__)
+#define SKETCH_LOG_WARN(log, ...) SKETCH_LOG_AT(log, LogLevel::WARN, warn, __VA_ARGS__)
+
+constexpr LogLevel compiledLogLevel(const LogCategory category) {
+    switch (category) {
+        case LogCategory::RENDER: return static_cast<LogLevel>(SKETCH_LOG_LEVEL_RENDER);
+        case LogCategory::INPUT: return static_cast<LogLevel>(SKETCH_LOG_LEVEL_INPUT);
+        case LogCategory::ASSET: return static_cast<LogLevel>(SKETCH_LOG_LEVEL_ASSET);
+        default: return static_cast<LogLevel>(SKETCH_LOG_LEVEL_CORE);
+    }
+}
+
+template <LogCategory Category = LogCategory::CORE>
+class logger {
+private:
+    // formats straight into the record so short messages never touch the heap, when the backend is deferring
+    // and every argument has a raw encoding only the argument bytes are copied and formatting happens later
+    template <typename... Args>
+    static void print(const LogLevel level, std::format_string<Args...> fmt, Args&&... args) {
+        logRecord record;
+        record.level = level;
+        record.category = Category;
+        record.time = std::chrono::system_clock::now();
+        if (logBackend::hasMonotonicTimestamps()) {
+            record.monotonicUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - logBackend::epoch()).count();
+        }
+        if constexpr (logArgs::deferrable<Args...>) {
+            size_t used = 0;
+            if (logBackend::isDeferred() && logArgs::encode(record.text.data(), record.text.size(), used, args...)) {
+                record.length = static_cast<uint32_t>(used);
+                record.format = fmt.get();
+                record.decode = &logArgs::decode<std::remove_cvref_t<Args>...>;
+                record.argTypes = logArgs::types<std::remove_cvref_t<Args>...>;
+                record.argCount = static_cast<uint8_t>(sizeof...(Args));
+                logBackend::submit(std::move(record));
+                if (level == LogLevel::FAIL) {
+                    fail();
+                }
+                return;
+            }
+        }
+        const auto result = std::format_to_n(record.text.data(), record.text.size(), fmt, std::forward<Args>(args)...);
+        if (static_cast<size_t>(result.size) > record.text.size()) {
+            memoryScope scope(MemoryTag::LOGGING);
+            record.overflow = std::format(fmt, std::forward<Args>(args)...);
+        }
+        record.length = static_cast<uint32_t>(result.out - record.text.data());
+        logBackend::submit(std::move(record));
+        if (level == LogLevel::FAIL) {
+            fail();
+        }
+    }
+
+    // other engine threads and then the worker are stopped before exit so the error is on disk and no thread
+    // outlives the statics, the hooks run while the worker is still draining so threads blocked on logging finish
+    static void fail() {
+        logBackend::enterFatal();
+        logBackend::runFatalHooks();
+        logBackend::stopAsync();
+        logBackend::flush();
+        if (logBackend::shouldPromptOnFatal()) {
+            std::cout << "Engine Shutting Down. Press Enter to Exit...\n";
+            std::cin.get();
+        }
+        exit(1);
+    }
+public:
+    // errors and the banner are never filtered so a fatal error always stops the engine
+    static constexpr bool compiledIn(const LogLevel level) {
+        return level >= LogLevel::FAIL || level >= compiledLogLevel(Category);
+    }
+    static bool isEnabled(const LogLevel level) {
+        return compiledIn(level) && (level >= LogLevel::FAIL || level >= logBackend::getLevel(Category));
+    }
+
+    void init() {
+        log("  ---[[WELCOME TO SKETCH ENGINE!]]---  ");
+    }
+
+    template <typename... Args>
+    void debug(std::format_string<Args...> fmt, Args&&... args) {
+        if constexpr (compiledIn(LogLevel::TEST)) {
+            if (isEnabled(LogLevel::TEST)) print(LogLevel::TEST, fmt, std::forward<Args>(args)...);
+        }
+    }
+    template <typename... Args>
+    void info(std::format_string<Args...> fmt, Args&&... args) {
+        if constexpr (compiledIn(LogLevel::INFO)) {
+            if (isEnabled(LogLevel::INFO)) print(LogLevel::INFO, fmt, std::forward<Args>(args)...);
+        }
+    }
+    template <typename... Args>
+    void warn(std::format_string<Args...> fmt, Args&&... args) {
+        if constexpr (compiledIn(LogLevel::WARN)) {
+            if (isEnabled(LogLevel::WARN)) print(LogLevel::WARN, fmt, std::forward<Args>(args)...);
+        }
+    }
+    template <typename... Args>
+    void error(std::format_string<Args...> fmt, Args&&... args) {
+        print(LogLevel::FAIL, fmt, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    void log(std::format_string<Args...> fmt, Args&&... args) {
+        print(LogLevel::SPECIAL, fmt, std::forward<Args>(args)...);
+    }
+};
@@ -1,7 +1,12 @@
-#include "core/application.h"
-
-int main(){
-    application app;
-    app.start();
-    return 0;
+#include "core/application.h"
+#include "profiling/memoryTracker.h"
+
+int main(int argc, char** argv){
+    {
+        application app(applicationSettings::fromArgs(argc, argv));
+        app.start();
+    }
+    // only once the application is gone, its scene and snapshots are tagged and would read as leaks
+    memoryTracker::reportLeaks();
+    return 0;
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "cpuProfiler.h"
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
+void cpuProfiler::setEnabled(const bool enabled) {
+    if (enabled && !isEnabled()) {
+        _captureStartNs.store(now(), std::memory_order_relaxed);
+    }
+    _enabled.store(enabled);
+    if (enabled) return;
+    // pairs with popScope, a writer either sees capture stopped or is seen here and waited for
+    std::lock_guard lock(_registryMutex);
+    for (const auto& buffer : _buffers) {
+        while (buffer->writing.load()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+cpuProfiler::threadBuffer& cpuProfiler::localBuffer() {
+    // buffers are never freed so exporting still sees threads that already exited
+    thread_local threadBuffer* buffer = [] {
+        std::lock_guard lock(_registryMutex);
+        auto& created = _buffers.emplace_back(std::make_unique<threadBuffer>());
+        created->threadId = static_cast<uint32_t>(_buffers.size());
+        return created.get();
+    }();
+    return *buffer;
+}
+
+void cpuProfiler::setThreadName(const char* name) {
+    localBuffer().name = name;
+}
+
+uint32_t cpuProfiler::pushScope() {
+    return localBuffer().depth++;
+}
+
+void cpuProfiler::popScope(const char* name, const int64_t beginNs, const uint32_t depth) {
+    auto& buffer = localBuffer();
+    buffer.depth = depth;
+    buffer.writing.store(true);
+    if (_enabled.load()) {
+        const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+        buffer.events[head % EVENTS_PER_THREAD] = { name, beginNs, now(), depth, _frame.load(std::memory_order_relaxed) };
+        buffer.head.store(head + 1, std::memory_order_release);
+    }
+    buffer.writing.store(false, std::memory_order_release);
+}
+
+void cpuProfiler::markFrame() {
+    _frame.fetch_add(1, std::memory_order_relaxed);
+    if (!isEnabled()) return;
+    auto& buffer = localBuffer();
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    const uint64_t first = std::max(buffer.frameStart, head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0);
+    buildFrame(buffer, first, head);
+    buffer.frameStart = head;
+}
+
+void cpuProfiler::buildFrame(const threadBuffer& buffer, const uint64_t first, const uint64_t last) {
+    // events are stored as scopes close, sort back into begin order so parents come before children
+    std::vector<const cpuEvent*> events;
+    events.reserve(last - first);
+    for (uint64_t i = first; i < last; i++) {
+        events.push_back(&buffer.events[i % EVENTS_PER_THREAD]);
+    }
+    std::ranges::sort(events, [](const cpuEvent* a, const cpuEvent* b) {
+        return a->beginNs != b->beginNs ? a->beginNs < b->beginNs : a->depth < b->depth;
+    });
+
+    _lastFrame.clear();
+    std::vector<int32_t> parents;
+    for (const cpuEvent* event : events) {
+        parents.resize(std::min<size_t>(parents.size(), event->depth));
+        const int32_t parent = parents.empty() ? -1 : parents.back();
+        // merge repeated calls of the same scope under the same parent
+        int32_t node = -1;
+        for (int32_t i = parent + 1; i < static_cast<int32_t>(_lastFrame.size()); i++) {
+            if (_lastFrame[i].parent == parent && _lastFrame[i].name == event->name) {
+                node = i;
+                break;
+            }
+        }
+        if (node < 0) {
+            _lastFrame.push_back({ event->name, static_cast<uint32_t>(parents.size()), parent, 0.0, 0 });
+            node = static_cast<int32_t>(_lastFrame.size() - 1);
+        }
+        _lastFrame[node].totalMs += static_cast<double>(event->endNs - event->beginNs) / 1'000'000.0;
+        _lastFrame[node].calls++;
+        parents.push_back(node);
+    }
+}
+
+static void writeJsonString(std::ofstream& file, const char* text) {
+    file << '"';
+    for (const char* c = text; *c; c++) {
+        if (*c == '"' || *c == '\\') file << '\\';
+        file << *c;
+    }
+    file << '"';
+}
+
+bool cpuProfiler::writeChromeTrace(const std::string& filePath) {
+    if (isEnabled()) {
+        _log.warn("Stop the CPU capture before writing {}", filePath);
+        return false;
+    }
+    std::ofstream file(filePath);
+    if (!file) {
+        _log.warn("Failed to open trace file: {}", filePath);
+        return false;
+    }
+    const int64_t captureStart = _captureStartNs.load(std::memory_order_relaxed);
+    size_t written = 0;
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    std::lock_guard lock(_registryMutex);
+    for (const auto& buffer : _buffers) {
+        if (written) file << ",\n";
+        file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+        writeJsonString(file, buffer->name ? buffer->name : "thread");
+        file << "}}";
+        written++;
+
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        const uint64_t first = head > EVENTS_PER_THREAD ? head - EVENTS_PER_THREAD : 0;
+        for (uint64_t i = first; i < head; i++) {
+            const cpuEvent& event = buffer->events[i % EVENTS_PER_THREAD];
+            if (event.beginNs < captureStart) continue;
+            file << ",\n{\"name\":";
+            writeJsonString(file, event.name);
+            file << std::format(",\"cat\":\"sketch\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"frame\":{}}}}}",
+                                buffer->threadId, event.beginNs / 1000.0, (event.endNs - event.beginNs) / 1000.0, event.frame);
+            written++;
+        }
+    }
+    file << "\n]}\n";
+    _log.info("Wrote {} trace events to {}", written, filePath);
+    return true;
+}
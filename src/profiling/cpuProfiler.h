@@ -0,0 +1,108 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include "logging/logger.h"
+
+#define SKETCH_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SKETCH_PROFILE_CONCAT(a, b) SKETCH_PROFILE_CONCAT_IMPL(a, b)
+
+// scopes compile to nothing unless SKETCH_PROFILE is defined, and cost one relaxed load while recording is off
+#ifdef SKETCH_PROFILE
+    #define SKETCH_PROFILE_SCOPE(name) cpuScope SKETCH_PROFILE_CONCAT(_profileScope, __LINE__)(name)
+    #define SKETCH_PROFILE_FUNCTION() SKETCH_PROFILE_SCOPE(__func__)
+    #define SKETCH_PROFILE_FRAME() cpuProfiler::markFrame()
+    #define SKETCH_PROFILE_THREAD(name) cpuProfiler::setThreadName(name)
+#else
+    #define SKETCH_PROFILE_SCOPE(name) ((void)0)
+    #define SKETCH_PROFILE_FUNCTION() ((void)0)
+    #define SKETCH_PROFILE_FRAME() ((void)0)
+    #define SKETCH_PROFILE_THREAD(name) ((void)0)
+#endif
+
+struct cpuEvent {
+    const char* name;      //must outlive the profiler, string literals and __func__ only
+    int64_t beginNs;       //nanoseconds since the profiler epoch
+    int64_t endNs;
+    uint32_t depth;        //nesting depth on the recording thread
+    uint64_t frame;        //frame the scope started in
+};
+
+struct cpuFrameNode {
+    const char* name;
+    uint32_t depth;
+    int32_t parent;        //index of the parent node, -1 for roots
+    double totalMs;        //summed time of all calls this frame
+    uint32_t calls;
+};
+
+// CPU PROFILER - hierarchical scope timings recorded into per thread rings, exportable as chrome trace_event json
+class cpuProfiler {
+public:
+    // disabling returns once no thread is still writing an event, scopes that close later are dropped
+    static void setEnabled(bool enabled);
+    [[nodiscard]] static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+    static void setThreadName(const char* name);
+    static void markFrame();
+    [[nodiscard]] static const std::vector<cpuFrameNode>& getLastFrame() { return _lastFrame; }
+    // capture has to be stopped first, the rings are only stable while nobody records
+    static bool writeChromeTrace(const std::string& filePath);
+
+    [[nodiscard]] static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _epoch).count();
+    }
+    static uint32_t pushScope();
+    static void popScope(const char* name, int64_t beginNs, uint32_t depth);
+private:
+    static constexpr size_t EVENTS_PER_THREAD = 1 << 16;
+
+    // written only by its owning thread, head is published with release for the owner's frame view
+    // writing brackets every event store so stopping a capture can wait for the last one before anything is exported
+    struct threadBuffer {
+        std::array<cpuEvent, EVENTS_PER_THREAD> events;
+        std::atomic<uint64_t> head = 0;
+        std::atomic<bool> writing = false;
+        uint32_t depth = 0;
+        uint32_t threadId = 0;
+        const char* name = nullptr;
+        uint64_t frameStart = 0; //first event index of the current frame
+    };
+    static threadBuffer& localBuffer();
+    static void buildFrame(const threadBuffer& buffer, uint64_t first, uint64_t last);
+
+    // shared with the logger so monotonic log timestamps line up with trace events
+    static inline const std::chrono::steady_clock::time_point _epoch = logBackend::epoch();
+    static inline std::atomic<bool> _enabled = false;
+    static inline std::atomic<uint64_t> _frame = 0;
+    static inline std::atomic<int64_t> _captureStartNs = 0;
+    static inline std::mutex _registryMutex;
+    static inline std::vector<std::unique_ptr<threadBuffer>> _buffers;
+    static inline std::vector<cpuFrameNode> _lastFrame;
+    static inline logger<LogCategory::CORE> _log;
+};
+
+class cpuScope {
+public:
+    explicit cpuScope(const char* name) : _name(name) {
+        if (cpuProfiler::isEnabled()) {
+            _depth = cpuProfiler::pushScope();
+            _beginNs = cpuProfiler::now();
+        }
+    }
+    ~cpuScope() {
+        if (_beginNs >= 0) {
+            cpuProfiler::popScope(_name, _beginNs, _depth);
+        }
+    }
+    cpuScope(const cpuScope&) = delete;
+    cpuScope& operator=(const cpuScope&) = delete;
+private:
+    const char* _name;
+    int64_t _beginNs = -1;
+    uint32_t _depth = 0;
+};
@@ -0,0 +1,34 @@
+#include "frameStats.h"
+#include <algorithm>
+#include "memoryTracker.h"
+
+void frameStats::endFrame() {
+    const auto now = std::chrono::steady_clock::now();
+    const double frameMs = _frameCount ? std::chrono::duration<double, std::milli>(now - _lastFrame).count() : 0.0;
+    _lastFrame = now;
+    _frameTimes[_frameCount % HISTORY] = static_cast<float>(frameMs);
+    _frameCount++;
+
+    // percentiles over the rolling window, 240 samples is cheap enough to select every frame
+    const size_t count = std::min(_frameCount, HISTORY);
+    std::array<float, HISTORY> sorted = _frameTimes;
+    const auto percentile = [&](const double p) {
+        const size_t index = std::min(count - 1, static_cast<size_t>(p * static_cast<double>(count)));
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + count);
+        return static_cast<double>(sorted[index]);
+    };
+
+    _summary.frameMs = frameMs;
+    _summary.p50Ms = percentile(0.50);
+    _summary.p95Ms = percentile(0.95);
+    _summary.p99Ms = percentile(0.99);
+    _summary.counters.drawCalls = _drawCalls.exchange(0, std::memory_order_relaxed);
+    _summary.counters.triangles = _triangles.exchange(0, std::memory_order_relaxed);
+    _summary.counters.stateChanges = _stateChanges.exchange(0, std::memory_order_relaxed);
+    _summary.counters.bytesUploaded = _bytesUploaded.exchange(0, std::memory_order_relaxed);
+    _summary.counters.allocations = _allocations.exchange(0, std::memory_order_relaxed);
+    memoryTracker::endFrame();
+    _summary.textureBytes = memoryTracker::getStats(MemoryTag::TEXTURE).gpuBytes;
+    _summary.gpuBytes = memoryTracker::getGpuBytes();
+    _summary.heapBytes = memoryTracker::getCpuBytes();
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+struct frameCounters {
+    uint32_t drawCalls = 0;
+    uint32_t triangles = 0;
+    uint32_t stateChanges = 0;   //program, vertex array and texture binds
+    uint64_t bytesUploaded = 0;  //buffer and texture data sent to the gpu
+    uint32_t allocations = 0;    //global operator new calls
+};
+
+struct frameSummary {
+    double frameMs = 0.0;
+    double p50Ms = 0.0;
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    frameCounters counters;
+    int64_t textureBytes = 0;    //texture memory currently alive
+    int64_t gpuBytes = 0;        //every tracked buffer and texture
+    int64_t heapBytes = 0;       //live global operator new memory
+};
+
+// FRAME STATS - per frame counters and a rolling window of frame times, counters may be bumped from any thread
+class frameStats {
+public:
+    static constexpr size_t HISTORY = 240;
+
+    static void addDrawCall(const uint32_t triangles) {
+        _drawCalls.fetch_add(1, std::memory_order_relaxed);
+        _triangles.fetch_add(triangles, std::memory_order_relaxed);
+    }
+    static void addStateChange() { _stateChanges.fetch_add(1, std::memory_order_relaxed); }
+    static void addBytesUploaded(const uint64_t bytes) { _bytesUploaded.fetch_add(bytes, std::memory_order_relaxed); }
+    static void addAllocation() { _allocations.fetch_add(1, std::memory_order_relaxed); }
+
+    // also latches the memory tracker's per frame rates
+    static void endFrame();
+
+    [[nodiscard]] static const frameSummary& getSummary() { return _summary; }
+    [[nodiscard]] static const std::array<float, HISTORY>& getFrameTimes() { return _frameTimes; }
+    [[nodiscard]] static size_t getNewestFrame() { return (_frameCount + HISTORY - 1) % HISTORY; }
+private:
+    static inline std::atomic<uint32_t> _drawCalls = 0;
+    static inline std::atomic<uint32_t> _triangles = 0;
+    static inline std::atomic<uint32_t> _stateChanges = 0;
+    static inline std::atomic<uint64_t> _bytesUploaded = 0;
+    static inline std::atomic<uint32_t> _allocations = 0;
+
+    static inline std::array<float, HISTORY> _frameTimes{};
+    static inline size_t _frameCount = 0;
+    static inline std::chrono::steady_clock::time_point _lastFrame{};
+    static inline frameSummary _summary;
+};
@@ -0,0 +1,107 @@
+#include "gpuProfiler.h"
+#include <cstring>
+
+gpuProfiler::gpuProfiler() {
+    for (auto& frame : _frames) {
+        frame.pool.resize(32);
+        glGenQueries(static_cast<GLsizei>(frame.pool.size()), frame.pool.data());
+    }
+}
+
+gpuProfiler::~gpuProfiler() {
+    for (auto& frame : _frames) {
+        glDeleteQueries(static_cast<GLsizei>(frame.pool.size()), frame.pool.data());
+    }
+}
+
+GLuint gpuProfiler::acquireQuery(frameQueries& frame) {
+    if (frame.used == frame.pool.size()) {
+        const auto oldSize = frame.pool.size();
+        frame.pool.resize(oldSize * 2);
+        glGenQueries(static_cast<GLsizei>(oldSize), frame.pool.data() + oldSize);
+    }
+    return frame.used++;
+}
+
+GLuint gpuProfiler::findScope(const char* name, const GLuint depth) {
+    for (GLuint i = 0; i < _scopes.size(); i++) {
+        if (_scopes[i].depth == depth && std::strcmp(_scopes[i].name, name) == 0) return i;
+    }
+    auto& created = _scopes.emplace_back();
+    created.name = name;
+    created.depth = depth;
+    return static_cast<GLuint>(_scopes.size() - 1);
+}
+
+void gpuProfiler::resolve(frameQueries& frame) {
+    // the last query closes the frame scope, once it is available every earlier one is too
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(frame.pool[frame.records.front().endQuery], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        _droppedFrames++;
+        return;
+    }
+    for (const auto& record : frame.records) {
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(frame.pool[record.beginQuery], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame.pool[record.endQuery], GL_QUERY_RESULT, &end);
+        auto& stats = _scopes[record.stats];
+        const GLuint sample = stats.sampleCount % stats.gpuSamples.size();
+        stats.gpuMs = static_cast<double>(end - begin) / 1'000'000.0;
+        stats.cpuMs = record.cpuMs;
+        stats.gpuSamples[sample] = stats.gpuMs;
+        stats.cpuSamples[sample] = stats.cpuMs;
+        stats.sampleCount++;
+    }
+}
+
+void gpuProfiler::beginFrame() {
+    _frameIndex++;
+    auto& frame = _frames[_frameIndex % FRAMES_IN_FLIGHT];
+    if (frame.pending && !frame.records.empty()) {
+        resolve(frame);
+    }
+    frame.used = 0;
+    frame.records.clear();
+    frame.pending = false;
+    _stack.clear();
+    beginScope("frame");
+}
+
+void gpuProfiler::endFrame() {
+    while (!_stack.empty()) {
+        endScope();
+    }
+    _frames[_frameIndex % FRAMES_IN_FLIGHT].pending = true;
+}
+
+void gpuProfiler::beginScope(const char* name) {
+    auto& frame = _frames[_frameIndex % FRAMES_IN_FLIGHT];
+    const GLuint stats = findScope(name, static_cast<GLuint>(_stack.size()));
+    const GLuint beginQuery = acquireQuery(frame);
+    glQueryCounter(frame.pool[beginQuery], GL_TIMESTAMP);
+    frame.records.push_back({ stats, beginQuery, 0, clock::now(), 0.0 });
+    _stack.push_back(static_cast<GLuint>(frame.records.size() - 1));
+}
+
+void gpuProfiler::endScope() {
+    if (_stack.empty()) {
+        _log.warn("gpuProfiler::endScope called without a matching beginScope");
+        return;
+    }
+    auto& frame = _frames[_frameIndex % FRAMES_IN_FLIGHT];
+    auto& record = frame.records[_stack.back()];
+    _stack.pop_back();
+    record.endQuery = acquireQuery(frame);
+    glQueryCounter(frame.pool[record.endQuery], GL_TIMESTAMP);
+    record.cpuMs = std::chrono::duration<double, std::milli>(clock::now() - record.cpuBegin).count();
+}
+
+void gpuProfiler::logReport() const {
+    _log.info("GPU profile ({} frames dropped while waiting on results)", _droppedFrames);
+    for (const auto& scope : _scopes) {
+        _log.info("{:>{}}{:<16} gpu {:7.3f} ms  cpu {:7.3f} ms", "", scope.depth * 2, scope.name,
+                  scope.averageGpuMs(), scope.averageCpuMs());
+    }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <glad/glad.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <vector>
+#include "logging/logger.h"
+
+struct gpuScopeStats {
+    const char* name = nullptr;
+    GLuint depth = 0;                      //nesting depth, 0 is the frame itself
+    double gpuMs = 0.0;                    //latest resolved gpu time
+    double cpuMs = 0.0;                    //latest cpu submission time
+    std::array<double, 64> gpuSamples{};   //rolling window of gpu times
+    std::array<double, 64> cpuSamples{};   //rolling window of cpu times
+    GLuint sampleCount = 0;
+
+    [[nodiscard]] double averageGpuMs() const { return average(gpuSamples); }
+    [[nodiscard]] double averageCpuMs() const { return average(cpuSamples); }
+private:
+    [[nodiscard]] double average(const std::array<double, 64>& samples) const {
+        const GLuint count = std::min<GLuint>(sampleCount, samples.size());
+        double total = 0.0;
+        for (GLuint i = 0; i < count; i++) total += samples[i];
+        return count ? total / count : 0.0;
+    }
+};
+
+// GPU PROFILER - timestamp queries around named scopes, resolved a few frames late so reading never stalls
+class gpuProfiler {
+public:
+    gpuProfiler();
+    ~gpuProfiler();
+    void beginFrame();
+    void endFrame();
+    void beginScope(const char* name);
+    void endScope();
+    [[nodiscard]] const std::vector<gpuScopeStats>& getScopes() const { return _scopes; }
+    [[nodiscard]] GLuint getDroppedFrames() const { return _droppedFrames; }
+    void logReport() const;
+private:
+    using clock = std::chrono::steady_clock;
+    struct scopeRecord {
+        GLuint stats;          //index into _scopes
+        GLuint beginQuery;     //index into the frame query pool
+        GLuint endQuery;
+        clock::time_point cpuBegin;
+        double cpuMs;
+    };
+    struct frameQueries {
+        std::vector<GLuint> pool;
+        GLuint used = 0;
+        std::vector<scopeRecord> records;
+        bool pending = false;
+    };
+    GLuint acquireQuery(frameQueries& frame);
+    GLuint findScope(const char* name, GLuint depth);
+    void resolve(frameQueries& frame);
+
+    static constexpr GLuint FRAMES_IN_FLIGHT = 3;
+
+    std::array<frameQueries, FRAMES_IN_FLIGHT> _frames;
+    std::vector<GLuint> _stack;
+    std::vector<gpuScopeStats> _scopes;
+    GLuint _frameIndex = 0;
+    GLuint _droppedFrames = 0;
+    static inline logger<LogCategory::RENDER> _log;
+};
+
+// scoped helper so a pass can't forget to close its timer
+class gpuScope {
+public:
+    gpuScope(gpuProfiler& profiler, const char* name) : _profiler(profiler) { _profiler.beginScope(name); }
+    ~gpuScope() { _profiler.endScope(); }
+    gpuScope(const gpuScope&) = delete;
+    gpuScope& operator=(const gpuScope&) = delete;
+private:
+    gpuProfiler& _profiler;
+};
@@ -0,0 +1,193 @@
+#include "memoryTracker.h"
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "frameStats.h"
+#include "logging/logger.h"
+
+// every block carries its size and tag so a free is charged back to whoever allocated it, the header sits right
+// below the returned pointer and offset leads back to what malloc returned, which only differs for over-aligned blocks
+struct alignas(std::max_align_t) allocationHeader {
+    uint64_t size;
+    uint32_t offset;
+    MemoryTag tag;
+};
+
+static void* allocate(const std::size_t size, const std::size_t alignment) {
+    frameStats::addAllocation();
+    // malloc already aligns to the header, anything stricter gets enough slack to move the block up
+    const std::size_t slack = alignment > alignof(allocationHeader) ? alignment : 0;
+    auto* base = static_cast<char*>(std::malloc(sizeof(allocationHeader) + slack + size));
+    if (!base) return nullptr;
+    const auto start = reinterpret_cast<std::uintptr_t>(base) + sizeof(allocationHeader);
+    auto* memory = slack ? reinterpret_cast<char*>((start + alignment - 1) & ~(alignment - 1)) : base + sizeof(allocationHeader);
+    auto* header = reinterpret_cast<allocationHeader*>(memory) - 1;
+    header->size = size;
+    header->offset = static_cast<uint32_t>(memory - base);
+    header->tag = memoryTracker::currentTag();
+    memoryTracker::onAllocate(header->tag, size);
+    return memory;
+}
+
+// tracking replacement for the global allocator, array and nothrow forms forward here by default
+void* operator new(const std::size_t size) {
+    void* memory = allocate(size, alignof(allocationHeader));
+    if (!memory) throw std::bad_alloc();
+    return memory;
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, alignof(allocationHeader));
+}
+
+// alignas types above max_align_t, e.g. cache line aligned containers
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    void* memory = allocate(size, static_cast<std::size_t>(alignment));
+    if (!memory) throw std::bad_alloc();
+    return memory;
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept {
+    if (!memory) return;
+    auto* header = static_cast<allocationHeader*>(memory) - 1;
+    memoryTracker::onFree(header->tag, header->size);
+    std::free(static_cast<char*>(memory) - header->offset);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    ::operator delete(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    ::operator delete(memory);
+}
+
+static logger<> memoryLog;
+
+static void raise(std::atomic<int64_t>& peak, const int64_t value) {
+    int64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+static double toKilobytes(const int64_t bytes) {
+    return static_cast<double>(bytes) / 1024.0;
+}
+
+const char* memoryTracker::tagName(const MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::RENDER: return "RENDER";
+        case MemoryTag::TEXTURE: return "TEXTURE";
+        case MemoryTag::LOGGING: return "LOGGING";
+        case MemoryTag::ASSETS: return "ASSETS";
+        case MemoryTag::SCENE: return "SCENE";
+        default: return "UNTAGGED";
+    }
+}
+
+void memoryTracker::onAllocate(const MemoryTag tag, const size_t bytes) {
+    memoryTagCounters& tagCounters = at(tag);
+    const int64_t live = tagCounters.cpuBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) + static_cast<int64_t>(bytes);
+    raise(tagCounters.cpuPeak, live);
+    tagCounters.cpuBlocks.fetch_add(1, std::memory_order_relaxed);
+    tagCounters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+    tagCounters.frameBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void memoryTracker::onFree(const MemoryTag tag, const size_t bytes) {
+    memoryTagCounters& tagCounters = at(tag);
+    tagCounters.cpuBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    tagCounters.cpuBlocks.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void memoryTracker::trackGpu(const MemoryTag tag, const int64_t bytes) {
+    memoryTagCounters& tagCounters = at(tag);
+    const int64_t live = tagCounters.gpuBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    raise(tagCounters.gpuPeak, live);
+}
+
+void memoryTracker::setBudget(const MemoryTag tag, const int64_t cpuBytes, const int64_t gpuBytes) {
+    at(tag).cpuBudget.store(cpuBytes, std::memory_order_relaxed);
+    at(tag).gpuBudget.store(gpuBytes, std::memory_order_relaxed);
+}
+
+void memoryTracker::endFrame() {
+    for (size_t i = 0; i < TAG_COUNT; i++) {
+        memoryTagCounters& tagCounters = _counters[i];
+        _lastFrame[i] = getStats(static_cast<MemoryTag>(i));
+        _lastFrame[i].frameAllocations = tagCounters.frameAllocations.exchange(0, std::memory_order_relaxed);
+        _lastFrame[i].frameBytes = tagCounters.frameBytes.exchange(0, std::memory_order_relaxed);
+
+        const int64_t cpuBudget = tagCounters.cpuBudget.load(std::memory_order_relaxed);
+        const int64_t gpuBudget = tagCounters.gpuBudget.load(std::memory_order_relaxed);
+        const bool overCpu = cpuBudget > 0 && _lastFrame[i].cpuBytes > cpuBudget;
+        const bool overGpu = gpuBudget > 0 && _lastFrame[i].gpuBytes > gpuBudget;
+        if ((overCpu || overGpu) && !tagCounters.overBudget) {
+            memoryLog.warn("{} is over its memory budget: heap {:.1f} / {:.1f} KB  gpu {:.1f} / {:.1f} KB",
+                           tagName(static_cast<MemoryTag>(i)), toKilobytes(_lastFrame[i].cpuBytes), toKilobytes(cpuBudget),
+                           toKilobytes(_lastFrame[i].gpuBytes), toKilobytes(gpuBudget));
+        }
+        tagCounters.overBudget = overCpu || overGpu;
+    }
+}
+
+// live values are current, the per frame rates are the ones latched by the last endFrame
+memoryTagStats memoryTracker::getStats(const MemoryTag tag) {
+    const memoryTagCounters& tagCounters = at(tag);
+    memoryTagStats stats = _lastFrame[static_cast<size_t>(tag)];
+    stats.cpuBytes = tagCounters.cpuBytes.load(std::memory_order_relaxed);
+    stats.cpuPeak = tagCounters.cpuPeak.load(std::memory_order_relaxed);
+    stats.cpuBlocks = tagCounters.cpuBlocks.load(std::memory_order_relaxed);
+    stats.gpuBytes = tagCounters.gpuBytes.load(std::memory_order_relaxed);
+    stats.gpuPeak = tagCounters.gpuPeak.load(std::memory_order_relaxed);
+    return stats;
+}
+
+int64_t memoryTracker::getCpuBytes() {
+    int64_t total = 0;
+    for (const memoryTagCounters& tagCounters : _counters) {
+        total += tagCounters.cpuBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+int64_t memoryTracker::getGpuBytes() {
+    int64_t total = 0;
+    for (const memoryTagCounters& tagCounters : _counters) {
+        total += tagCounters.gpuBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void memoryTracker::logReport() {
+    memoryLog.info("Memory by tag (heap live / peak, gpu live / peak, allocations last frame)");
+    for (size_t i = 0; i < TAG_COUNT; i++) {
+        const memoryTagStats stats = getStats(static_cast<MemoryTag>(i));
+        memoryLog.info("  {:<9} heap {:9.1f} / {:9.1f} KB  gpu {:9.1f} / {:9.1f} KB  {:5} allocs {:8.1f} KB",
+                       tagName(static_cast<MemoryTag>(i)), toKilobytes(stats.cpuBytes), toKilobytes(stats.cpuPeak),
+                       toKilobytes(stats.gpuBytes), toKilobytes(stats.gpuPeak), stats.frameAllocations,
+                       toKilobytes(static_cast<int64_t>(stats.frameBytes)));
+    }
+}
+
+// untagged memory is skipped, it includes statics that are only released after this runs
+void memoryTracker::reportLeaks() {
+    bool leaked = false;
+    for (size_t i = 1; i < TAG_COUNT; i++) {
+        const memoryTagStats stats = getStats(static_cast<MemoryTag>(i));
+        if (stats.cpuBlocks == 0 && stats.gpuBytes == 0) continue;
+        memoryLog.warn("Leaked at shutdown: {} heap {:.1f} KB in {} blocks, gpu {:.1f} KB",
+                       tagName(static_cast<MemoryTag>(i)), toKilobytes(stats.cpuBytes), stats.cpuBlocks, toKilobytes(stats.gpuBytes));
+        leaked = true;
+    }
+    if (!leaked) {
+        SKETCH_LOG_DEBUG(memoryLog, "No tagged memory alive at shutdown");
+    }
+}
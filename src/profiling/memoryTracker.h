@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+enum class MemoryTag : uint8_t {
+    UNTAGGED,
+    RENDER,
+    TEXTURE,
+    LOGGING,
+    ASSETS,
+    SCENE,
+    COUNT
+};
+
+struct memoryTagStats {
+    int64_t cpuBytes = 0;           //live heap bytes
+    int64_t cpuPeak = 0;
+    int64_t cpuBlocks = 0;          //live heap allocations
+    int64_t gpuBytes = 0;           //buffers and textures currently alive
+    int64_t gpuPeak = 0;
+    uint32_t frameAllocations = 0;  //heap allocations during the last finished frame
+    uint64_t frameBytes = 0;
+};
+
+// live counters for one tag, bumped from any thread
+struct memoryTagCounters {
+    std::atomic<int64_t> cpuBytes = 0;
+    std::atomic<int64_t> cpuPeak = 0;
+    std::atomic<int64_t> cpuBlocks = 0;
+    std::atomic<int64_t> gpuBytes = 0;
+    std::atomic<int64_t> gpuPeak = 0;
+    std::atomic<uint32_t> frameAllocations = 0;
+    std::atomic<uint64_t> frameBytes = 0;
+    std::atomic<int64_t> cpuBudget = 0;
+    std::atomic<int64_t> gpuBudget = 0;
+    bool overBudget = false;  //only touched by endFrame, warns once per crossing
+};
+
+// MEMORY TRACKER - every global operator new is charged to the calling thread's current tag, GPU buffers and
+// textures report their sizes themselves, budgets are checked once per frame so the allocator itself never logs
+class memoryTracker {
+public:
+    [[nodiscard]] static const char* tagName(MemoryTag tag);
+    [[nodiscard]] static MemoryTag currentTag() { return _currentTag; }
+
+    // called by the global allocator
+    static void onAllocate(MemoryTag tag, size_t bytes);
+    static void onFree(MemoryTag tag, size_t bytes);
+    // positive when a buffer or texture is created, negative when it is released
+    static void trackGpu(MemoryTag tag, int64_t bytes);
+
+    // 0 means no budget, a warning is logged each time a tag goes over
+    static void setBudget(MemoryTag tag, int64_t cpuBytes, int64_t gpuBytes);
+    // latches the per frame allocation rates and checks budgets, logReport reads the latched values so both
+    // have to be called from the same thread, the render thread when rendering is threaded
+    static void endFrame();
+
+    [[nodiscard]] static memoryTagStats getStats(MemoryTag tag);
+    [[nodiscard]] static int64_t getCpuBytes();
+    [[nodiscard]] static int64_t getGpuBytes();
+    static void logReport();
+    // call once the engine has released everything it owns, tagged memory still alive is reported as leaked
+    static void reportLeaks();
+private:
+    friend class memoryScope;
+    static constexpr size_t TAG_COUNT = static_cast<size_t>(MemoryTag::COUNT);
+
+    static memoryTagCounters& at(const MemoryTag tag) { return _counters[static_cast<size_t>(tag)]; }
+
+    // constant initialised, the allocator may run before any dynamic initialiser
+    static inline std::array<memoryTagCounters, TAG_COUNT> _counters{};
+    static inline std::array<memoryTagStats, TAG_COUNT> _lastFrame{};
+    static inline thread_local MemoryTag _currentTag = MemoryTag::UNTAGGED;
+};
+
+// charges heap allocations made on this thread to tag until the scope ends, scopes nest
+class memoryScope {
+public:
+    explicit memoryScope(const MemoryTag tag) : _previous(memoryTracker::_currentTag) { memoryTracker::_currentTag = tag; }
+    ~memoryScope() { memoryTracker::_currentTag = _previous; }
+    memoryScope(const memoryScope&) = delete;
+    memoryScope& operator=(const memoryScope&) = delete;
+private:
+    MemoryTag _previous;
+};
@@ -0,0 +1,58 @@
+#include "commandBuffer.h"
+#include <algorithm>
+#include <memory>
+#include "core/jobSystem.h"
+#include "profiling/cpuProfiler.h"
+
+uint64_t makeSortKey(const shaderHandle program, const textureHandle tex, const vaoHandle vertexArray) {
+    // program switches cost the most so they get the highest bits
+    return static_cast<uint64_t>(program.index() & 0xFFFF) << 48
+         | static_cast<uint64_t>(tex.index() & 0xFFFFFF) << 24
+         | (vertexArray.index() & 0xFFFFFF);
+}
+
+// pmr containers never take a new resource on assignment, so the vector is rebuilt in place
+// its old storage belongs to an arena that has been reset and freeing into an arena is a no-op
+template <typename T>
+static void rebind(std::pmr::vector<T>& items, std::pmr::memory_resource& memory) {
+    const size_t expected = items.size();
+    std::destroy_at(&items);
+    std::construct_at(&items, &memory);
+    items.reserve(expected);
+}
+
+void commandBuffer::begin(std::pmr::memory_resource& memory) {
+    rebind(_packets, memory);
+}
+
+void commandQueue::begin(frameArena& arena) {
+    if (_buffers.size() != arena.getCount()) {
+        _buffers.resize(arena.getCount());
+    }
+    for (size_t i = 0; i < _buffers.size(); i++) {
+        _buffers[i].begin(arena.at(i));
+    }
+    rebind(_merged, arena.local());
+}
+
+commandBuffer& commandQueue::local() {
+    const int index = jobSystem::getThreadIndex();
+    return index >= 0 && static_cast<size_t>(index) + 1 < _buffers.size() ? _buffers[index] : _buffers.back();
+}
+
+std::span<const drawPacket> commandQueue::merge() {
+    SKETCH_PROFILE_FUNCTION();
+    size_t total = 0;
+    for (const commandBuffer& buffer : _buffers) {
+        total += buffer.getPackets().size();
+    }
+    _merged.reserve(total);
+    for (const commandBuffer& buffer : _buffers) {
+        const auto packets = buffer.getPackets();
+        _merged.insert(_merged.end(), packets.begin(), packets.end());
+    }
+    std::sort(_merged.begin(), _merged.end(), [](const drawPacket& a, const drawPacket& b) {
+        return a.sortKey != b.sortKey ? a.sortKey < b.sortKey : a.object < b.object;
+    });
+    return _merged;
+}
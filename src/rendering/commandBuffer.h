@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+#include "math/math.h"
+#include "core/frameArena.h"
+#include "gpuHandles.h"
+
+// one draw with everything needed to issue it, recording never touches GL so packets can be built on any thread
+struct drawPacket {
+    uint64_t sortKey = 0;            //packets are replayed in key order, state changes only happen when the key changes
+    shaderHandle program;
+    vaoHandle vertexArray;
+    textureHandle tex;
+    Mat4 model;                      //per draw uniform block
+    uint32_t indexCount = 0;
+    uint32_t firstIndex = 0;
+    uint32_t object = 0;             //occlusion id, also breaks ties so the order never depends on which thread recorded
+};
+
+// packs program, texture and vertex array pool indices so sorting groups draws sharing state
+uint64_t makeSortKey(shaderHandle program, textureHandle tex, vaoHandle vertexArray);
+
+// COMMAND BUFFER - draw packets recorded by a single thread into that thread's frame arena
+class alignas(64) commandBuffer {
+public:
+    // starts an empty buffer in memory, reserving as much as the previous frame used
+    void begin(std::pmr::memory_resource& memory);
+    void draw(const drawPacket& packet) { _packets.push_back(packet); }
+    [[nodiscard]] std::span<const drawPacket> getPackets() const { return _packets; }
+private:
+    std::pmr::vector<drawPacket> _packets;
+};
+
+// COMMAND QUEUE - one command buffer per job system thread, recorded in parallel then merged into a single sorted list
+class commandQueue {
+public:
+    // points every buffer at its thread's arena, call on the submitting thread after arena.begin and before recording
+    void begin(frameArena& arena);
+    // the buffer owned by the calling thread, unregistered threads share the last one and must not record concurrently
+    [[nodiscard]] commandBuffer& local();
+    // concatenates and sorts the buffers, call once every recording job has finished
+    // the result lives in the submitting thread's arena, so only until the arena is reset
+    std::span<const drawPacket> merge();
+private:
+    std::vector<commandBuffer> _buffers;
+    std::pmr::vector<drawPacket> _merged;
+};
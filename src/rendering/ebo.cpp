@@ -1,14 +1,17 @@
-#include "ebo.h"
-
-ebo::ebo(GLuint* indices, GLsizeiptr size) : _indices(indices), _size(size) {
-    glGenBuffers(1, &_id);
-}
-
-ebo::~ebo() {
-    glDeleteBuffers(1, &_id);
-}
-
-void ebo::bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, _size, _indices, GL_STATIC_DRAW);
+#include "ebo.h"
+
+ebo::ebo(GLuint* indices, GLsizeiptr size) : _indices(indices), _size(size) {
+    glGenBuffers(1, &_id);
+    memoryTracker::trackGpu(MemoryTag::RENDER, size);
+}
+
+ebo::~ebo() {
+    memoryTracker::trackGpu(MemoryTag::RENDER, -_size);
+    glDeleteBuffers(1, &_id);
+}
+
+void ebo::bind() const {
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, _size, _indices, GL_STATIC_DRAW);
+    frameStats::addBytesUploaded(_size);
 }
\ No newline at end of file
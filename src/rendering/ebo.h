@@ -1,14 +1,16 @@
-#pragma once
-#include <glad/glad.h>
-
-//ELEMENT BUFFER OBJECT - determines the order in which vertices are drawn to prevent duplicates
-class ebo {
-public:
-    ebo(GLuint* indices, GLsizeiptr size);
-    ~ebo();
-    void bind() const;
-private:
-    GLuint* _indices;
-    GLsizeiptr _size;
-    GLuint _id{};
-};
+#pragma once
+#include <glad/glad.h>
+#include "profiling/frameStats.h"
+#include "profiling/memoryTracker.h"
+
+//ELEMENT BUFFER OBJECT - determines the order in which vertices are drawn to prevent duplicates
+class ebo {
+public:
+    ebo(GLuint* indices, GLsizeiptr size);
+    ~ebo();
+    void bind() const;
+private:
+    GLuint* _indices;
+    GLsizeiptr _size;
+    GLuint _id{};
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include "core/resourcePool.h"
+
+class vbo;
+class ebo;
+class vao;
+class texture;
+class shader;
+
+using vboHandle = handle<vbo>;
+using eboHandle = handle<ebo>;
+using vaoHandle = handle<vao>;
+using textureHandle = handle<texture>;
+using shaderHandle = handle<shader>;
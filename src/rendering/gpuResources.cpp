@@ -0,0 +1,12 @@
+#include "gpuResources.h"
+
+void gpuResources::clear() {
+    const size_t remaining = _vaos.size() + _vbos.size() + _ebos.size() + _textures.size() + _shaders.size();
+    SKETCH_LOG_DEBUG(_log, "Releasing {} GPU resources", remaining);
+    // vertex arrays first, they refer to the buffers
+    _vaos.clear();
+    _vbos.clear();
+    _ebos.clear();
+    _textures.clear();
+    _shaders.clear();
+}
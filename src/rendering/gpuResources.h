@@ -0,0 +1,28 @@
+#pragma once
+#include "gpuHandles.h"
+#include "vbo.h"
+#include "ebo.h"
+#include "vao.h"
+#include "shaders/shader.h"
+#include "utils/texture.h"
+
+// GPU RESOURCES - pools owning every GL object wrapper, everything else refers to them by handle
+// only touch them on the thread that owns the GL context
+class gpuResources {
+public:
+    [[nodiscard]] static resourcePool<vbo>& vbos() { return _vbos; }
+    [[nodiscard]] static resourcePool<ebo>& ebos() { return _ebos; }
+    [[nodiscard]] static resourcePool<vao>& vaos() { return _vaos; }
+    [[nodiscard]] static resourcePool<texture>& textures() { return _textures; }
+    [[nodiscard]] static resourcePool<shader>& shaders() { return _shaders; }
+
+    // destroys whatever is left, call while the context is still current
+    static void clear();
+private:
+    static inline resourcePool<vbo> _vbos;
+    static inline resourcePool<ebo> _ebos;
+    static inline resourcePool<vao> _vaos;
+    static inline resourcePool<texture> _textures;
+    static inline resourcePool<shader> _shaders;
+    static inline logger<LogCategory::RENDER> _log;
+};
@@ -0,0 +1,158 @@
+#include "occlusion.h"
+#include <cstring>
+
+constexpr float cubeVertices[] = {
+    -0.5f, -0.5f, -0.5f,
+     0.5f, -0.5f, -0.5f,
+     0.5f,  0.5f, -0.5f,
+    -0.5f,  0.5f, -0.5f,
+    -0.5f, -0.5f,  0.5f,
+     0.5f, -0.5f,  0.5f,
+     0.5f,  0.5f,  0.5f,
+    -0.5f,  0.5f,  0.5f
+};
+constexpr GLuint cubeIndices[] = {
+    0, 1, 2, 0, 2, 3, //back
+    4, 6, 5, 4, 7, 6, //front
+    0, 4, 5, 0, 5, 1, //bottom
+    3, 2, 6, 3, 6, 7, //top
+    0, 3, 7, 0, 7, 4, //left
+    1, 5, 6, 1, 6, 2  //right
+};
+
+occlusion::occlusion() {
+    // conservative queries are core in 4.3 and exposed through ES3 compatibility, they let the driver skip exact coverage
+    if (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3) || hasExtension("GL_ARB_ES3_compatibility")) {
+        _queryTarget = GL_ANY_SAMPLES_PASSED_CONSERVATIVE;
+    }
+    _boundsShader = gpuResources::shaders().create("../src/rendering/shaders/bounds.vert", "../src/rendering/shaders/bounds.frag");
+
+    glGenVertexArrays(1, &_cubeVao);
+    glGenBuffers(1, &_cubeVbo);
+    glGenBuffers(1, &_cubeEbo);
+    glBindVertexArray(_cubeVao);
+    glBindBuffer(GL_ARRAY_BUFFER, _cubeVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _cubeEbo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, GL_STATIC_DRAW);
+    //position attribute
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glBindVertexArray(0);
+    SKETCH_LOG_DEBUG(_log, "Occlusion culling using {}", _queryTarget == GL_ANY_SAMPLES_PASSED_CONSERVATIVE ? "conservative queries" : "exact queries");
+}
+
+occlusion::~occlusion() {
+    for (auto& object : _objects) {
+        glDeleteQueries(2, object.queries);
+    }
+    glDeleteBuffers(1, &_cubeEbo);
+    glDeleteBuffers(1, &_cubeVbo);
+    glDeleteVertexArrays(1, &_cubeVao);
+    gpuResources::shaders().destroy(_boundsShader);
+}
+
+bool occlusion::hasExtension(const char* name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        const auto* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (extension && std::strcmp(extension, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+occlusionObject& occlusion::getObject(const GLuint object) {
+    while (_objects.size() <= object) {
+        auto& created = _objects.emplace_back();
+        glGenQueries(2, created.queries);
+    }
+    return _objects[object];
+}
+
+void occlusion::beginFrame() {
+    _frame++;
+    _culledCount = 0;
+    // read the slot from two frames ago first so the result from last frame wins when both are ready
+    const GLuint slots[2] = { _frame % 2, (_frame + 1) % 2 };
+    for (auto& object : _objects) {
+        for (const GLuint slot : slots) {
+            if (!object.issued[slot]) continue;
+            GLuint available = GL_FALSE;
+            glGetQueryObjectuiv(object.queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) continue; // never block, try again next frame
+            GLuint samplesPassed = 0;
+            glGetQueryObjectuiv(object.queries[slot], GL_QUERY_RESULT, &samplesPassed);
+            object.issued[slot] = false;
+            object.visible = samplesPassed != 0;
+        }
+    }
+}
+
+bool occlusion::isVisible(const GLuint object) {
+    if (!_enabled) return true;
+    if (getObject(object).visible) return true;
+    _culledCount++;
+    return false;
+}
+
+void occlusion::beginDraw(const GLuint object) const {
+    // let the GPU discard the draw itself if a query is still in flight when the draw is reached
+    if (!_conditionalRender || object >= _objects.size()) return;
+    const auto& state = _objects[object];
+    if (state.issued[0] || state.issued[1]) {
+        glBeginConditionalRender(state.lastQuery, GL_QUERY_NO_WAIT);
+    }
+}
+
+void occlusion::endDraw(const GLuint object) const {
+    if (!_conditionalRender || object >= _objects.size()) return;
+    const auto& state = _objects[object];
+    if (state.issued[0] || state.issued[1]) {
+        glEndConditionalRender();
+    }
+}
+
+void occlusion::submit(const GLuint object, const Vec3& min, const Vec3& max, const Mat4& model) {
+    if (!_enabled) return;
+    auto& state = getObject(object);
+    // temporal coherence - visible objects tend to stay visible so they are tested less often
+    if (state.visible && state.framesUntilTest > 0) {
+        state.framesUntilTest--;
+        return;
+    }
+    const Vec3 center = (min + max) * 0.5f;
+    const Vec3 size = (max - min) + Vec3(BOUNDS_PADDING);
+    _pending.push_back({ object, model * Mat4::translation(center) * Mat4::scale(size) });
+}
+
+void occlusion::issueQueries(const Mat4& view, const Mat4& projection) {
+    if (_pending.empty()) return;
+    const GLuint slot = _frame % 2;
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    glDepthMask(GL_FALSE);
+    glDepthFunc(GL_LEQUAL);
+    const shader* boundsShader = gpuResources::shaders().get(_boundsShader);
+    boundsShader->use();
+    boundsShader->setMatrix4("view", &view.m[0][0]);
+    boundsShader->setMatrix4("projection", &projection.m[0][0]);
+    glBindVertexArray(_cubeVao);
+    for (const auto& [object, model] : _pending) {
+        auto& state = _objects[object];
+        boundsShader->setMatrix4("model", &model.m[0][0]);
+        glBeginQuery(_queryTarget, state.queries[slot]);
+        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, nullptr);
+        frameStats::addDrawCall(12);
+        glEndQuery(_queryTarget);
+        state.issued[slot] = true;
+        state.lastQuery = state.queries[slot];
+        state.framesUntilTest = VISIBLE_RETEST_INTERVAL;
+    }
+    glBindVertexArray(0);
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    _pending.clear();
+}
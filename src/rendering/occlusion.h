@@ -0,0 +1,57 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include "math/math.h"
+#include "gpuResources.h"
+#include "profiling/frameStats.h"
+
+#ifndef GL_ANY_SAMPLES_PASSED_CONSERVATIVE
+    #define GL_ANY_SAMPLES_PASSED_CONSERVATIVE 0x8D6A
+#endif
+
+struct occlusionObject {
+    GLuint queries[2]{};      //double buffered queries, indexed by frame parity
+    bool issued[2]{};         //was the query in this slot issued
+    bool visible = true;      //last known visibility, objects start visible
+    GLuint lastQuery = 0;     //most recently issued query, used for conditional rendering
+    GLuint framesUntilTest = 0; //visible objects are only re-tested every few frames
+};
+
+// OCCLUSION CULLING - tests bounding boxes against the depth buffer, results are read a frame late to avoid stalls
+class occlusion {
+public:
+    occlusion();
+    ~occlusion();
+    void beginFrame();
+    [[nodiscard]] bool isVisible(GLuint object);
+    void beginDraw(GLuint object) const;
+    void endDraw(GLuint object) const;
+    void submit(GLuint object, const Vec3& min, const Vec3& max, const Mat4& model);
+    void issueQueries(const Mat4& view, const Mat4& projection);
+    [[nodiscard]] GLuint getCulledCount() const { return _culledCount; }
+    void setEnabled(bool enabled) { _enabled = enabled; }
+    void setConditionalRender(bool enabled) { _conditionalRender = enabled; }
+private:
+    struct pendingQuery {
+        GLuint object;
+        Mat4 model;
+    };
+    occlusionObject& getObject(GLuint object);
+    static bool hasExtension(const char* name);
+
+    static constexpr GLuint VISIBLE_RETEST_INTERVAL = 4;
+    static constexpr float BOUNDS_PADDING = 0.001f;
+
+    std::vector<occlusionObject> _objects;
+    std::vector<pendingQuery> _pending;
+    shaderHandle _boundsShader;
+    GLuint _cubeVao{};
+    GLuint _cubeVbo{};
+    GLuint _cubeEbo{};
+    GLenum _queryTarget = GL_ANY_SAMPLES_PASSED;
+    GLuint _frame = 0;
+    GLuint _culledCount = 0;
+    bool _enabled = true;
+    bool _conditionalRender = true;
+    static inline logger<LogCategory::RENDER> _log;
+};
@@ -1,18 +1,103 @@
-#include "renderer.h"
-
-renderer::renderer(shader& shaderProgram, vao& VAO, texture& tex) : _shaderProgram(&shaderProgram), _vao(&VAO), _texture(&tex) {}
-
-void renderer::render(const Mat4& model, const Mat4& view, const Mat4& projection) {
-    glEnable(GL_DEPTH_TEST);
-    glClearColor(0.1f, 0.3f, 0.4f, 0.9f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    _shaderProgram->use();
-    _shaderProgram->setInt("texture1", 0);
-    _shaderProgram->setMatrix4("model", &model.m[0][0]);
-    _shaderProgram->setMatrix4("view", &view.m[0][0]);
-    _shaderProgram->setMatrix4("projection", &projection.m[0][0]);
-    _texture->bind(0);
-    _vao->bind();
-    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
-    vao::unbind();
-}
+#include "renderer.h"
+
+renderer::renderer(const shaderHandle shaderProgram, const vaoHandle VAO, const textureHandle tex) : _shaderProgram(shaderProgram), _vao(VAO), _texture(tex) {}
+
+void renderer::render(const std::span<const Mat4> models, const std::span<const uint32_t> objectIds, const Mat4& view, const Mat4& projection) {
+    SKETCH_PROFILE_FUNCTION();
+    memoryScope scope(MemoryTag::RENDER);
+    _arena.begin();
+    record(models, objectIds);
+    const std::span<const drawPacket> packets = _commands.merge();
+
+    _gpuProfiler.beginFrame();
+    {
+        gpuScope scope(_gpuProfiler, "clear");
+        glEnable(GL_DEPTH_TEST);
+        glClearColor(0.1f, 0.3f, 0.4f, 0.9f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+    _occlusion.beginFrame();
+    {
+        gpuScope scope(_gpuProfiler, "scene");
+        execute(packets, view, projection);
+    }
+    {
+        gpuScope scope(_gpuProfiler, "occlusion");
+        for (const drawPacket& packet : packets) {
+            const vao* vertexArray = gpuResources::vaos().get(packet.vertexArray);
+            const vbo* vertices = vertexArray ? gpuResources::vbos().get(vertexArray->getVbo()) : nullptr;
+            if (!vertices) continue;
+            _occlusion.submit(packet.object, vertices->getBoundsMin(), vertices->getBoundsMax(), packet.model);
+        }
+        _occlusion.issueQueries(view, projection);
+    }
+    {
+        gpuScope scope(_gpuProfiler, "overlay");
+        _statsOverlay.render(_occlusion.getCulledCount());
+    }
+    _gpuProfiler.endFrame();
+    // the packets were the last thing using this frame's memory
+    _arena.reset();
+}
+
+// each job appends to its own thread's buffer, nothing here may call into GL
+void renderer::record(const std::span<const Mat4> models, const std::span<const uint32_t> objectIds) {
+    SKETCH_PROFILE_FUNCTION();
+    _commands.begin(_arena);
+    const uint64_t sortKey = makeSortKey(_shaderProgram, _texture, _vao);
+    jobSystem::parallelFor(models, RECORD_GRAIN, [&](const std::span<const Mat4> chunk) {
+        commandBuffer& buffer = _commands.local();
+        for (const Mat4& model : chunk) {
+            drawPacket packet;
+            packet.sortKey = sortKey;
+            packet.program = _shaderProgram;
+            packet.vertexArray = _vao;
+            packet.tex = _texture;
+            packet.model = model;
+            packet.indexCount = 6;
+            const auto index = static_cast<uint32_t>(&model - models.data());
+            packet.object = objectIds.empty() ? index : objectIds[index];
+            buffer.draw(packet);
+        }
+    });
+}
+
+// replays the merged packets, state is only rebound when it differs from the previous packet
+void renderer::execute(const std::span<const drawPacket> packets, const Mat4& view, const Mat4& projection) {
+    SKETCH_PROFILE_FUNCTION();
+    const shader* boundProgram = nullptr;
+    const texture* boundTexture = nullptr;
+    const vao* boundVao = nullptr;
+    for (const drawPacket& packet : packets) {
+        // a resource destroyed after recording just drops the draw
+        const shader* program = gpuResources::shaders().get(packet.program);
+        const texture* tex = gpuResources::textures().get(packet.tex);
+        const vao* vertexArray = gpuResources::vaos().get(packet.vertexArray);
+        if (!program || !tex || !vertexArray) continue;
+        if (!_occlusion.isVisible(packet.object)) continue;
+        if (program != boundProgram) {
+            boundProgram = program;
+            boundProgram->use();
+            boundProgram->setInt("texture1", 0);
+            boundProgram->setMatrix4("view", &view.m[0][0]);
+            boundProgram->setMatrix4("projection", &projection.m[0][0]);
+        }
+        if (tex != boundTexture) {
+            boundTexture = tex;
+            boundTexture->bind(0);
+        }
+        if (vertexArray != boundVao) {
+            boundVao = vertexArray;
+            boundVao->bind();
+        }
+        boundProgram->setMatrix4("model", &packet.model.m[0][0]);
+        _occlusion.beginDraw(packet.object);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(packet.indexCount), GL_UNSIGNED_INT,
+                       reinterpret_cast<const void*>(static_cast<uintptr_t>(packet.firstIndex) * sizeof(GLuint)));
+        frameStats::addDrawCall(packet.indexCount / 3);
+        _occlusion.endDraw(packet.object);
+    }
+    if (boundVao) {
+        vao::unbind();
+    }
+}
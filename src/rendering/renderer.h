@@ -1,17 +1,37 @@
-#pragma once
-#include "vao.h"
-#include "shaders/shader.h"
-#include "math/math.h"
-#include "utils/texture.h"
-
-class renderer {
-public:
-    renderer(shader& shaderProgram, vao& VAO, texture& tex);
-    ~renderer() = default;
-    void render(const Mat4& model, const Mat4& view, const Mat4& projection);
-private:
-    shader* _shaderProgram;
-    vao* _vao;
-    texture* _texture;
-    static inline logger _log;
-};
+#pragma once
+#include <span>
+#include "gpuResources.h"
+#include "commandBuffer.h"
+#include "occlusion.h"
+#include "statsOverlay.h"
+#include "math/math.h"
+#include "profiling/gpuProfiler.h"
+#include "profiling/cpuProfiler.h"
+#include "core/jobSystem.h"
+
+class renderer {
+public:
+    renderer(shaderHandle shaderProgram, vaoHandle VAO, textureHandle tex);
+    ~renderer() = default;
+    // draw packets are recorded on the job system, only the replay touches GL
+    // objectIds keys the occlusion state of each model, pass an empty span when the models keep their order every frame
+    void render(std::span<const Mat4> models, std::span<const uint32_t> objectIds, const Mat4& view, const Mat4& projection);
+    [[nodiscard]] GLuint getCulledDraws() const { return _occlusion.getCulledCount(); }
+    [[nodiscard]] gpuProfiler& getGpuProfiler() { return _gpuProfiler; }
+    void toggleStatsOverlay() { _statsOverlay.toggle(); }
+private:
+    void record(std::span<const Mat4> models, std::span<const uint32_t> objectIds);
+    void execute(std::span<const drawPacket> packets, const Mat4& view, const Mat4& projection);
+
+    static constexpr size_t RECORD_GRAIN = 256;  //objects per recording job
+
+    shaderHandle _shaderProgram;
+    vaoHandle _vao;
+    textureHandle _texture;
+    frameArena _arena{ MemoryTag::RENDER };  //per frame scratch memory, declared first so it outlives the containers using it
+    commandQueue _commands;
+    occlusion _occlusion;
+    gpuProfiler _gpuProfiler;
+    statsOverlay _statsOverlay;
+    static inline logger<LogCategory::RENDER> _log;
+};
@@ -0,0 +1,15 @@
+#version 330 core
+
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec4 aColor;
+
+out vec4 vColor;
+
+uniform vec2 screenSize;
+
+void main() {
+    // pixel coordinates with the origin in the top left corner
+    vec2 ndc = aPos / screenSize * 2.0 - 1.0;
+    gl_Position = vec4(ndc.x, -ndc.y, 0.0, 1.0);
+    vColor = aColor;
+}
\ No newline at end of file
@@ -1,23 +1,33 @@
-#pragma once
-#include <glad/glad.h>
-#include <string>
-#include <fstream>
-#include <sstream>
-#include "logging/logger.h"
-
-class shader {
-public:
-    shader(const char* vertexPath, const char* fragmentPath);
-    void use() const;
-    void setBool(const std::string& name, bool value) const;
-    void setInt(const std::string& name, int value) const;
-    void setFloat(const std::string& name, float value) const;
-    void setMatrix4(const std::string& name, const float* matrix) const;
-private:
-    static std::string readFile(const std::string& filePath);
-    static void checkCompileErrors(GLuint shader, const std::string& type);
-    static inline logger _log;
-    GLuint _vertex;
-    GLuint _fragment;
-    GLuint _id;
-};
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include "logging/logger.h"
+#include "profiling/frameStats.h"
+#include "profiling/memoryTracker.h"
+
+class shader {
+public:
+    shader(const char* vertexPath, const char* fragmentPath);
+    void use() const;
+    [[nodiscard]] GLuint getId() const { return _id; }
+    void setBool(std::string_view name, bool value) const;
+    void setInt(std::string_view name, int value) const;
+    void setFloat(std::string_view name, float value) const;
+    void setVec2(std::string_view name, float x, float y) const;
+    void setMatrix4(std::string_view name, const float* matrix) const;
+    // looked up once per name, later calls are a short scan of the names seen so far
+    [[nodiscard]] GLint getUniformLocation(std::string_view name) const;
+private:
+    static std::string readFile(const std::string& filePath);
+    static void checkCompileErrors(GLuint shader, const std::string& type);
+    static inline logger<LogCategory::RENDER> _log;
+    GLuint _vertex;
+    GLuint _fragment;
+    GLuint _id;
+    mutable std::vector<std::pair<std::string, GLint>> _uniforms;  //a program has a handful of uniforms, a linear scan beats hashing
+};
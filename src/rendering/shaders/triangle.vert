@@ -1,21 +1,21 @@
-#version 330 core
-
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aColor;
-layout (location = 2) in vec3 aNormal;
-layout (location = 3) in vec2 aTexCoord;
-
-out vec3 vColor;
-out vec3 vNormal;
-out vec2 vTexCoord;
-
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
-
-void main() {
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
-    vColor = aColor;
-    vNormal = aNormal;
-    vTexCoord = aTexCoord;
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec3 aNormal;
+layout (location = 3) in vec2 aTexCoord;
+
+out vec3 vColor;
+out vec3 vNormal;
+out vec2 vTexCoord;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+
+void main() {
+    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    vColor = aColor;
+    vNormal = aNormal;
+    vTexCoord = aTexCoord;
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "statsOverlay.h"
+#include <algorithm>
+#include <cctype>
+#include <format>
+
+// 3x5 bitmap font, one bit per pixel with rows top to bottom
+static uint16_t glyph(const char c) {
+    switch (std::toupper(static_cast<unsigned char>(c))) {
+        case '0': return 0b111'101'101'101'111;
+        case '1': return 0b010'110'010'010'111;
+        case '2': return 0b111'001'111'100'111;
+        case '3': return 0b111'001'111'001'111;
+        case '4': return 0b101'101'111'001'001;
+        case '5': return 0b111'100'111'001'111;
+        case '6': return 0b111'100'111'101'111;
+        case '7': return 0b111'001'001'001'001;
+        case '8': return 0b111'101'111'101'111;
+        case '9': return 0b111'101'111'001'111;
+        case 'A': return 0b010'101'111'101'101;
+        case 'B': return 0b110'101'110'101'110;
+        case 'C': return 0b011'100'100'100'011;
+        case 'D': return 0b110'101'101'101'110;
+        case 'E': return 0b111'100'110'100'111;
+        case 'F': return 0b111'100'110'100'100;
+        case 'G': return 0b011'100'101'101'011;
+        case 'H': return 0b101'101'111'101'101;
+        case 'I': return 0b111'010'010'010'111;
+        case 'J': return 0b001'001'001'101'010;
+        case 'K': return 0b101'101'110'101'101;
+        case 'L': return 0b100'100'100'100'111;
+        case 'M': return 0b101'111'111'101'101;
+        case 'N': return 0b110'101'101'101'101;
+        case 'O': return 0b010'101'101'101'010;
+        case 'P': return 0b110'101'110'100'100;
+        case 'Q': return 0b010'101'101'110'011;
+        case 'R': return 0b110'101'110'101'101;
+        case 'S': return 0b011'100'010'001'110;
+        case 'T': return 0b111'010'010'010'010;
+        case 'U': return 0b101'101'101'101'111;
+        case 'V': return 0b101'101'101'101'010;
+        case 'W': return 0b101'101'111'111'101;
+        case 'X': return 0b101'101'010'101'101;
+        case 'Y': return 0b101'101'010'010'010;
+        case 'Z': return 0b111'001'010'100'111;
+        case '.': return 0b000'000'000'000'010;
+        case ':': return 0b000'010'000'010'000;
+        case '-': return 0b000'000'111'000'000;
+        case '/': return 0b001'001'010'100'100;
+        case '%': return 0b101'001'010'100'101;
+        default: return 0;
+    }
+}
+
+static Vec4 frameColor(const float ms) {
+    if (ms <= 1000.0f / 60.0f) return { 0.4f, 0.9f, 0.4f, 1.0f };
+    if (ms <= 1000.0f / 30.0f) return { 1.0f, 0.9f, 0.3f, 1.0f };
+    return { 1.0f, 0.4f, 0.4f, 1.0f };
+}
+
+statsOverlay::statsOverlay() {
+    _shader = gpuResources::shaders().create("../src/rendering/shaders/overlay.vert", "../src/rendering/shaders/overlay.frag");
+    glGenVertexArrays(1, &_vao);
+    glGenBuffers(1, &_vbo);
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    //position attribute
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    // color attribute
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glBindVertexArray(0);
+}
+
+statsOverlay::~statsOverlay() {
+    glDeleteBuffers(1, &_vbo);
+    glDeleteVertexArrays(1, &_vao);
+    gpuResources::shaders().destroy(_shader);
+}
+
+void statsOverlay::addQuad(const float x, const float y, const float width, const float height, const Vec4& color) {
+    const float corners[6][2] = {
+        { x, y }, { x + width, y }, { x + width, y + height },
+        { x, y }, { x + width, y + height }, { x, y + height }
+    };
+    for (const auto& corner : corners) {
+        _vertices.insert(_vertices.end(), { corner[0], corner[1], color.x, color.y, color.z, color.w });
+    }
+}
+
+void statsOverlay::addText(float x, const float y, const std::string& text, const Vec4& color) {
+    for (const char c : text) {
+        const uint16_t bits = glyph(c);
+        for (int row = 0; row < 5; row++) {
+            for (int column = 0; column < 3; column++) {
+                if (bits & (1 << (14 - row * 3 - column))) {
+                    addQuad(x + column * PIXEL, y + row * PIXEL, PIXEL, PIXEL, color);
+                }
+            }
+        }
+        x += 4 * PIXEL;
+    }
+}
+
+void statsOverlay::render(const GLuint culledDraws) {
+    if (!_visible) return;
+    const frameSummary& stats = frameStats::getSummary();
+    const Vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
+    const std::string lines[] = {
+        std::format("FPS {:.1f}  FRAME {:.2f} MS", stats.frameMs > 0.0 ? 1000.0 / stats.frameMs : 0.0, stats.frameMs),
+        std::format("P50 {:.2f}  P95 {:.2f}  P99 {:.2f}", stats.p50Ms, stats.p95Ms, stats.p99Ms),
+        std::format("DRAWS {}  TRIS {}  CULLED {}", stats.counters.drawCalls, stats.counters.triangles, culledDraws),
+        std::format("STATE CHANGES {}  ALLOCS {}", stats.counters.stateChanges, stats.counters.allocations),
+        std::format("UPLOAD {:.1f} KB  TEXTURES {:.1f} MB", stats.counters.bytesUploaded / 1024.0, stats.textureBytes / (1024.0 * 1024.0)),
+        std::format("HEAP {:.1f} MB  GPU {:.1f} MB", stats.heapBytes / (1024.0 * 1024.0), stats.gpuBytes / (1024.0 * 1024.0)),
+    };
+
+    _vertices.clear();
+    constexpr float margin = 16.0f;
+    constexpr float padding = 8.0f;
+    const float graphWidth = static_cast<float>(frameStats::HISTORY) * 2.0f;
+    float width = graphWidth;
+    for (const auto& line : lines) {
+        width = std::max(width, static_cast<float>(line.size()) * 4 * PIXEL);
+    }
+    const float height = std::size(lines) * LINE_HEIGHT + GRAPH_HEIGHT + padding;
+    addQuad(margin, margin, width + padding * 2, height + padding * 2, { 0.0f, 0.0f, 0.0f, 0.6f });
+
+    float y = margin + padding;
+    for (const auto& line : lines) {
+        addText(margin + padding, y, line, white);
+        y += LINE_HEIGHT;
+    }
+
+    // frame time graph, oldest frame on the left with a 60hz budget line
+    const float graphBottom = y + padding + GRAPH_HEIGHT;
+    const auto& times = frameStats::getFrameTimes();
+    for (size_t i = 0; i < frameStats::HISTORY; i++) {
+        const float ms = times[(frameStats::getNewestFrame() + 1 + i) % frameStats::HISTORY];
+        const float barHeight = std::min(ms, GRAPH_MAX_MS) / GRAPH_MAX_MS * GRAPH_HEIGHT;
+        addQuad(margin + padding + i * 2.0f, graphBottom - barHeight, 2.0f, barHeight, frameColor(ms));
+    }
+    const float budgetY = graphBottom - (1000.0f / 60.0f) / GRAPH_MAX_MS * GRAPH_HEIGHT;
+    addQuad(margin + padding, budgetY, graphWidth, 1.0f, white);
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glDisable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    const shader* program = gpuResources::shaders().get(_shader);
+    program->use();
+    program->setVec2("screenSize", static_cast<float>(viewport[2]), static_cast<float>(viewport[3]));
+    glBindVertexArray(_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_vertices.size() * sizeof(float)), _vertices.data(), GL_STREAM_DRAW);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(_vertices.size() / 6));
+    glBindVertexArray(0);
+    glDisable(GL_BLEND);
+    glEnable(GL_DEPTH_TEST);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include "math/math.h"
+#include "gpuResources.h"
+#include "profiling/frameStats.h"
+
+// STATS OVERLAY - draws frame statistics as bitmap text and a frame time graph on top of the scene
+class statsOverlay {
+public:
+    statsOverlay();
+    ~statsOverlay();
+    void render(GLuint culledDraws);
+    void toggle() { _visible = !_visible; }
+    [[nodiscard]] bool isVisible() const { return _visible; }
+private:
+    void addQuad(float x, float y, float width, float height, const Vec4& color);
+    void addText(float x, float y, const std::string& text, const Vec4& color);
+
+    static constexpr float PIXEL = 3.0f;           //screen pixels per font pixel
+    static constexpr float LINE_HEIGHT = 7 * PIXEL;
+    static constexpr float GRAPH_HEIGHT = 120.0f;
+    static constexpr float GRAPH_MAX_MS = 50.0f;
+
+    std::vector<float> _vertices;
+    shaderHandle _shader;
+    GLuint _vao{};
+    GLuint _vbo{};
+    bool _visible = false;
+};
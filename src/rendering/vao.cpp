@@ -1,19 +1,21 @@
-#include "vao.h"
-
-vao::vao(vbo& VBO, ebo& EBO) : _vbo(VBO), _ebo(EBO) {
-    glGenVertexArrays(1, &_id);
-    bind();
-    VBO.bind();
-    EBO.bind();
-}
-vao::~vao() {
-    glDeleteVertexArrays(1, &_id);
-}
-
-void vao::bind() const {
-    glBindVertexArray(_id);
-}
-
-void vao::unbind() {
-    glBindVertexArray(0);
-}
+#include "vao.h"
+#include "gpuResources.h"
+
+vao::vao(const vboHandle VBO, const eboHandle EBO) : _vbo(VBO), _ebo(EBO) {
+    glGenVertexArrays(1, &_id);
+    bind();
+    if (const vbo* vertices = gpuResources::vbos().get(VBO)) vertices->bind();
+    if (const ebo* elements = gpuResources::ebos().get(EBO)) elements->bind();
+}
+vao::~vao() {
+    glDeleteVertexArrays(1, &_id);
+}
+
+void vao::bind() const {
+    frameStats::addStateChange();
+    glBindVertexArray(_id);
+}
+
+void vao::unbind() {
+    glBindVertexArray(0);
+}
@@ -1,17 +1,20 @@
-#pragma once
-#include <glad/glad.h>
-#include "vbo.h"
-#include "ebo.h"
-
-// VERTEX ARRAY OBJECT - stores the vertex attribute structure
-class vao {
-public:
-    vao(vbo& VBO, ebo& EBO);
-    ~vao();
-    void bind() const;
-    static void unbind() ;
-private:
-    vbo& _vbo;
-    ebo& _ebo;
-    GLuint _id{};
-};
+#pragma once
+#include <glad/glad.h>
+#include "gpuHandles.h"
+#include "profiling/frameStats.h"
+
+// VERTEX ARRAY OBJECT - stores the vertex attribute structure, the buffers are referenced by handle
+class vao {
+public:
+    vao(vboHandle VBO, eboHandle EBO);
+    ~vao();
+    void bind() const;
+    static void unbind() ;
+    [[nodiscard]] vboHandle getVbo() const { return _vbo; }
+    [[nodiscard]] eboHandle getEbo() const { return _ebo; }
+    [[nodiscard]] GLuint getId() const { return _id; }
+private:
+    vboHandle _vbo;
+    eboHandle _ebo;
+    GLuint _id{};
+};
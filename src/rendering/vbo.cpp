@@ -1,24 +1,34 @@
-#include "vbo.h"
-
-vbo::vbo(const float* vertices, const GLsizeiptr size) : _vertices(vertices), _size(size) {
-    glGenBuffers(1, &_id);
-}
-vbo::~vbo() {
-    glDeleteBuffers(1, &_id);
-}
-void vbo::bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, _id);
-    glBufferData(GL_ARRAY_BUFFER, _size, _vertices, GL_STATIC_DRAW);
-    //position attribute
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
-    // color attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(1);
-    // normal attribute
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)(6 * sizeof(float)));
-    glEnableVertexAttribArray(2);
-    // texture attribute
-    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)(9 * sizeof(float)));
-    glEnableVertexAttribArray(3);
-}
+#include "vbo.h"
+
+vbo::vbo(const float* vertices, const GLsizeiptr size) : _vertices(vertices), _size(size) {
+    glGenBuffers(1, &_id);
+    memoryTracker::trackGpu(MemoryTag::RENDER, size);
+    // local space bounds from the position attribute, used for culling
+    const GLsizeiptr vertexCount = size / static_cast<GLsizeiptr>(11 * sizeof(float));
+    for (GLsizeiptr i = 0; i < vertexCount; i++) {
+        const Vec3 position(vertices[i * 11], vertices[i * 11 + 1], vertices[i * 11 + 2]);
+        _boundsMin = i == 0 ? position : _boundsMin.min(position);
+        _boundsMax = i == 0 ? position : _boundsMax.max(position);
+    }
+}
+vbo::~vbo() {
+    memoryTracker::trackGpu(MemoryTag::RENDER, -_size);
+    glDeleteBuffers(1, &_id);
+}
+void vbo::bind() const {
+    glBindBuffer(GL_ARRAY_BUFFER, _id);
+    glBufferData(GL_ARRAY_BUFFER, _size, _vertices, GL_STATIC_DRAW);
+    frameStats::addBytesUploaded(_size);
+    //position attribute
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    // color attribute
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    // normal attribute
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)(6 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    // texture attribute
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 11 * sizeof(float), (void*)(9 * sizeof(float)));
+    glEnableVertexAttribArray(3);
+}
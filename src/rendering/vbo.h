@@ -1,14 +1,21 @@
-#pragma once
-#include <glad/glad.h>
-
-// VERTEX BUFFER OBJECT - stores vertex data in GPU memory
-class vbo {
-public:
-    vbo(const float* vertices, GLsizeiptr size);
-    ~vbo();
-    void bind() const;
-private:
-    const float* _vertices;
-    GLsizeiptr _size;
-    GLuint _id{};
-};
+#pragma once
+#include <glad/glad.h>
+#include "math/math.h"
+#include "profiling/frameStats.h"
+#include "profiling/memoryTracker.h"
+
+// VERTEX BUFFER OBJECT - stores vertex data in GPU memory
+class vbo {
+public:
+    vbo(const float* vertices, GLsizeiptr size);
+    ~vbo();
+    void bind() const;
+    [[nodiscard]] const Vec3& getBoundsMin() const { return _boundsMin; }
+    [[nodiscard]] const Vec3& getBoundsMax() const { return _boundsMax; }
+private:
+    const float* _vertices;
+    GLsizeiptr _size;
+    GLuint _id{};
+    Vec3 _boundsMin;
+    Vec3 _boundsMax;
+};
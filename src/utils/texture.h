@@ -1,19 +1,24 @@
-#pragma once
-#include <iostream>
-#include <string>
-#include <fstream>
-#include <glad/glad.h>
-#include <vector>
-#include "logging/logger.h"
-
-class texture {
-public:
-    texture() = default;
-    ~texture();
-    bool loadFromBMP(const std::string& filePath);
-    bool loadFromSTB(const std::string& filePath);
-    void bind(GLuint unit = 0) const;
-private:
-    static inline logger _log;
-    GLuint _id{};
-};
+#pragma once
+#include <iostream>
+#include <string>
+#include <fstream>
+#include <glad/glad.h>
+#include <vector>
+#include "logging/logger.h"
+#include "profiling/frameStats.h"
+#include "profiling/memoryTracker.h"
+
+class texture {
+public:
+    texture() = default;
+    ~texture();
+    bool loadFromBMP(const std::string& filePath);
+    bool loadFromSTB(const std::string& filePath);
+    void bind(GLuint unit = 0) const;
+    [[nodiscard]] GLuint getId() const { return _id; }
+private:
+    static inline logger<LogCategory::ASSET> _log;
+    void trackMemory(GLsizeiptr levelZeroBytes);
+    GLuint _id{};
+    GLsizeiptr _bytes = 0;
+};
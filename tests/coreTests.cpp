@@ -0,0 +1,363 @@
+#include "test.h"
+#include <algorithm>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+#include "core/mpscQueue.h"
+#include "core/workStealingDeque.h"
+#include "core/resourcePool.h"
+#include "core/fixedTimestep.h"
+#include "core/engineClock.h"
+#include "core/frameSnapshot.h"
+#include "core/frameArena.h"
+#include "core/jobSystem.h"
+
+static void mpscQueueOrder() {
+    mpscQueue<int, 4> queue;
+    for (int i = 0; i < 4; i++) {
+        int value = i;
+        SKETCH_CHECK(queue.tryPush(std::move(value)));
+    }
+    int overflow = 4;
+    SKETCH_CHECK(!queue.tryPush(std::move(overflow)));
+    for (int i = 0; i < 4; i++) {
+        int value = -1;
+        SKETCH_CHECK(queue.tryPop(value) && value == i);
+    }
+    int value = -1;
+    SKETCH_CHECK(!queue.tryPop(value));
+    SKETCH_CHECK(queue.empty());
+}
+
+static void mpscQueueProducers() {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    mpscQueue<int, 1024> queue;
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCERS; producer++) {
+        producers.emplace_back([&queue, producer] {
+            for (int i = 0; i < PER_PRODUCER; i++) {
+                int value = producer * PER_PRODUCER + i;
+                while (!queue.tryPush(std::move(value))) std::this_thread::yield();
+            }
+        });
+    }
+    // every value arrives exactly once and each producer's values stay in order
+    std::vector<int> seen(PRODUCERS * PER_PRODUCER, 0);
+    std::vector<int> last(PRODUCERS, -1);
+    for (int received = 0; received < PRODUCERS * PER_PRODUCER;) {
+        int value;
+        if (!queue.tryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        seen[value]++;
+        SKETCH_CHECK(value % PER_PRODUCER > last[value / PER_PRODUCER]);
+        last[value / PER_PRODUCER] = value % PER_PRODUCER;
+        received++;
+    }
+    for (std::thread& producer : producers) producer.join();
+    SKETCH_CHECK(std::ranges::all_of(seen, [](const int count) { return count == 1; }));
+    SKETCH_CHECK(queue.empty());
+}
+
+static void workStealingDequeEnds() {
+    int items[3]{};
+    workStealingDeque<int*, 4> deque;
+    for (int& item : items) SKETCH_CHECK(deque.push(&item));
+    SKETCH_CHECK(deque.steal() == &items[0]);
+    SKETCH_CHECK(deque.pop() == &items[2]);
+    SKETCH_CHECK(deque.pop() == &items[1]);
+    SKETCH_CHECK(deque.pop() == nullptr);
+    SKETCH_CHECK(deque.steal() == nullptr);
+    SKETCH_CHECK(deque.empty());
+    int extra[5]{};
+    for (int i = 0; i < 4; i++) SKETCH_CHECK(deque.push(&extra[i]));
+    SKETCH_CHECK(!deque.push(&extra[4]));
+}
+
+static void workStealingDequeThieves() {
+    constexpr int ITEMS = 100000;
+    constexpr int THIEVES = 3;
+    std::vector<int> items(ITEMS);
+    std::vector<std::atomic<int>> taken(ITEMS);
+    workStealingDeque<int*, 1024> deque;
+    std::atomic<bool> done = false;
+    const auto take = [&](const int* item) { taken[item - items.data()].fetch_add(1, std::memory_order_relaxed); };
+
+    std::vector<std::thread> thieves;
+    for (int thief = 0; thief < THIEVES; thief++) {
+        thieves.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                if (int* item = deque.steal()) take(item);
+            }
+        });
+    }
+    // the owner mixes pushes with pops so both ends are contended
+    for (int i = 0; i < ITEMS; i++) {
+        while (!deque.push(&items[i])) {
+            if (int* item = deque.pop()) take(item);
+        }
+        if (i % 3 == 0) {
+            if (int* item = deque.pop()) take(item);
+        }
+    }
+    while (int* item = deque.pop()) take(item);
+    while (!deque.empty()) std::this_thread::yield();
+    done.store(true, std::memory_order_release);
+    for (std::thread& thief : thieves) thief.join();
+    SKETCH_CHECK(std::ranges::all_of(taken, [](const std::atomic<int>& count) { return count.load() == 1; }));
+}
+
+static void resourcePoolGenerations() {
+    resourcePool<int> pool;
+    const handle<int> first = pool.create(1);
+    const handle<int> second = pool.create(2);
+    SKETCH_CHECK(first && second && first != second);
+    SKETCH_CHECK(*pool.get(first) == 1 && *pool.get(second) == 2);
+    SKETCH_CHECK(!pool.isValid({}));
+
+    // a freed slot is reused with a new generation, the old handle stops resolving
+    SKETCH_CHECK(pool.destroy(first));
+    SKETCH_CHECK(!pool.destroy(first));
+    const handle<int> reused = pool.create(3);
+    SKETCH_CHECK(reused.index() == first.index() && reused.generation() == first.generation() + 1);
+    SKETCH_CHECK(!pool.isValid(first) && *pool.get(reused) == 3);
+    SKETCH_CHECK(pool.size() == 2);
+
+    // a slot is retired once its generation runs out instead of wrapping back to a value old handles carry
+    handle<int> cycled = reused;
+    while (cycled.index() == reused.index()) {
+        pool.destroy(cycled);
+        cycled = pool.create(4);
+    }
+    SKETCH_CHECK(pool.isValid(cycled) && !pool.isValid(reused));
+    SKETCH_CHECK(pool.size() == 2);
+
+    size_t visited = 0;
+    pool.forEach([&visited](handle<int>, int&) { visited++; });
+    SKETCH_CHECK(visited == 2);
+    pool.clear();
+    SKETCH_CHECK(pool.size() == 0 && !pool.isValid(second));
+}
+
+static void fixedTimestepSteps() {
+    fixedTimestep simulation(50.0, 3);  //20 ms steps, exact in ticks
+    SKETCH_CHECK(simulation.advance(timestep(0.010)) == 0);
+    SKETCH_CHECK(std::abs(simulation.getAlpha() - 0.5f) < 1e-6f);
+    SKETCH_CHECK(simulation.advance(timestep(0.030)) == 2);
+    SKETCH_CHECK(simulation.getAlpha() == 0.0f);
+    SKETCH_CHECK(simulation.advance(timestep(-1.0)) == 0);
+
+    // a long stall pays out the step limit and drops the rest of the backlog
+    SKETCH_CHECK(simulation.advance(timestep(1.0)) == 3);
+    SKETCH_CHECK(simulation.getDroppedSteps() == 47);
+    SKETCH_CHECK(simulation.getStepCount() == 5);
+
+    // a thousand uneven frames adding up to ten seconds simulate exactly 500 steps
+    fixedTimestep steady(50.0, 1000);
+    int steps = 0;
+    for (int frame = 0; frame < 1000; frame++) {
+        steps += steady.advance(timestep::fromTicks(frame % 2 ? 13'000'000 : 7'000'000));
+    }
+    SKETCH_CHECK(steps == 500 && steady.getAlpha() == 0.0f);
+}
+
+static void scaledClockPauseAndScale() {
+    const int64_t before = engineClock::now();
+    SKETCH_CHECK(before >= 0 && engineClock::now() >= before);
+
+    scaledClock game;
+    SKETCH_CHECK(game.advance(timestep::fromTicks(16'000'000)).getTicks() == 16'000'000);
+    game.setPaused(true);
+    SKETCH_CHECK(game.advance(timestep::fromTicks(16'000'000)).getTicks() == 0);
+    SKETCH_CHECK(game.getTicks() == 16'000'000);
+    game.setPaused(false);
+
+    // a sub-clock fed its parent's delta stops while the parent is paused
+    scaledClock slow;
+    slow.setScale(0.5);
+    game.setScale(2.0);
+    SKETCH_CHECK(slow.advance(game.advance(timestep::fromTicks(10'000'000))).getTicks() == 10'000'000);
+    game.setPaused(true);
+    SKETCH_CHECK(slow.advance(game.advance(timestep::fromTicks(10'000'000))).getTicks() == 0);
+    SKETCH_CHECK(game.getTicks() == 36'000'000 && slow.getTicks() == 10'000'000);
+
+    // a third of a tick per frame is carried, so three frames add up to exactly one tick
+    scaledClock third;
+    third.setScale(1.0 / 3.0);
+    int64_t total = 0;
+    for (int frame = 0; frame < 3000; frame++) total += third.advance(timestep::fromTicks(1)).getTicks();
+    SKETCH_CHECK(total == 1000 && third.getTicks() == 1000);
+
+    third.setScale(-1.0);
+    SKETCH_CHECK(third.getScale() == 0.0 && third.advance(timestep::fromTicks(1'000)).getTicks() == 0);
+}
+
+static void snapshotQueueHandoff(const size_t slots) {
+    constexpr uint32_t FRAMES = 2000;
+    snapshotQueue queue(slots);
+    std::thread producer([&queue] {
+        for (uint32_t frame = 0; frame < FRAMES; frame++) {
+            frameSnapshot& snapshot = queue.acquire();
+            snapshot.frame = frame;
+            snapshot.models.assign(frame % 7, Mat4::translation(Vec3(static_cast<float>(frame))));
+            queue.publish();
+        }
+        queue.close();
+    });
+    // frames arrive in order, complete, and are never overwritten while the consumer holds them
+    uint32_t expected = 0;
+    while (const frameSnapshot* snapshot = queue.consume()) {
+        SKETCH_CHECK(snapshot->frame == expected);
+        SKETCH_CHECK(snapshot->models.size() == expected % 7);
+        for (const Mat4& model : snapshot->models) {
+            SKETCH_CHECK(model.m[0][3] == static_cast<float>(expected));
+        }
+        expected++;
+    }
+    producer.join();
+    SKETCH_CHECK(expected == FRAMES);
+}
+
+static void linearArenaReuse() {
+    linearArena arena(1024);
+    // spills past the first block, the reset merges the blocks so later frames fit in one
+    const auto frame = [&arena] {
+        void* first = arena.allocate(100, 8);
+        void* aligned = arena.allocate(64, 64);
+        SKETCH_CHECK(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+        SKETCH_CHECK(first != aligned);
+        for (int i = 0; i < 10; i++) (void)arena.allocate(512, 16);
+        SKETCH_CHECK(arena.getUsedBytes() == 100 + 64 + 10 * 512);
+        return first;
+    };
+    frame();
+    arena.reset();
+    SKETCH_CHECK(arena.getUsedBytes() == 0);
+    const void* first = frame();
+    const size_t capacity = arena.getCapacity();
+    SKETCH_CHECK(capacity >= arena.getPeakBytes());
+    arena.reset();
+    SKETCH_CHECK(frame() == first);
+    SKETCH_CHECK(arena.getCapacity() == capacity);
+    arena.reset();
+
+    std::pmr::vector<int> values(&arena);
+    for (int i = 0; i < 1000; i++) values.push_back(i);
+    SKETCH_CHECK(values[999] == 999);
+}
+
+static void jobCounters() {
+    // more jobs than a deque or job pool holds, so submitting also runs full-deque jobs inline and recycles pool slots
+    constexpr int JOBS = static_cast<int>(jobSystem::QUEUE_SIZE + jobSystem::POOL_SIZE) + 100;
+    std::atomic<int> ran = 0;
+    std::atomic<bool> badIndex = false;
+    jobCounter counter;
+    for (int i = 0; i < JOBS; i++) {
+        jobSystem::run([&ran, &badIndex] {
+            const int index = jobSystem::getThreadIndex();
+            if (index < 0 || static_cast<size_t>(index) >= jobSystem::getThreadCount()) badIndex.store(true);
+            ran.fetch_add(1, std::memory_order_relaxed);
+        }, &counter);
+    }
+    jobSystem::wait(counter);
+    SKETCH_CHECK(counter.isDone() && ran.load() == JOBS);
+    SKETCH_CHECK(!badIndex.load());
+
+    // a job can fan out more jobs and wait for them from inside a worker
+    jobCounter outer;
+    std::atomic<int> inner = 0;
+    for (int i = 0; i < 8; i++) {
+        jobSystem::run([&inner] {
+            jobCounter children;
+            for (int child = 0; child < 16; child++) jobSystem::run([&inner] { inner.fetch_add(1); }, &children);
+            jobSystem::wait(children);
+        }, &outer);
+    }
+    jobSystem::wait(outer);
+    SKETCH_CHECK(inner.load() == 8 * 16);
+}
+
+static void jobDependencies() {
+    constexpr size_t COUNT = 256;
+    std::vector<int> values(COUNT, 0);
+    jobCounter produced, consumed;
+    std::atomic<int> early = 0;
+    std::atomic<int64_t> sum = 0;
+    // consumers are submitted first, so they are what a worker finds before their inputs exist
+    for (size_t i = 0; i < COUNT; i++) {
+        jobSystem::run([&, i] {
+            if (!produced.isDone()) early.fetch_add(1);
+            sum.fetch_add(values[i], std::memory_order_relaxed);
+        }, &consumed, &produced);
+    }
+    for (size_t i = 0; i < COUNT; i++) {
+        jobSystem::run([&values, i] { values[i] = static_cast<int>(i); }, &produced);
+    }
+    jobSystem::wait(consumed);
+    SKETCH_CHECK(early.load() == 0);
+    SKETCH_CHECK(sum.load() == static_cast<int64_t>(COUNT * (COUNT - 1) / 2));
+}
+
+static void jobInlineFallback() {
+    // a thread that never registered has no deque, its jobs run on the spot before run returns
+    std::thread outside([] {
+        SKETCH_CHECK(jobSystem::getThreadIndex() == -1);
+        const std::thread::id self = std::this_thread::get_id();
+        bool ranHere = false;
+        jobCounter counter;
+        jobSystem::run([&ranHere, self] { ranHere = std::this_thread::get_id() == self; }, &counter);
+        SKETCH_CHECK(ranHere && counter.isDone());
+
+        // a dependency on registered work is still honoured, the thread waits for it before running inline
+        jobCounter first;
+        std::atomic<bool> firstDone = false;
+        bool ordered = false;
+        std::thread registered([&] {
+            SKETCH_CHECK(jobSystem::registerThread());
+            jobSystem::run([&firstDone] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                firstDone.store(true);
+            }, &first);
+            jobSystem::wait(first);
+        });
+        while (first.isDone() && !firstDone.load()) std::this_thread::yield();  //until the job has been submitted
+        jobSystem::run([&ordered, &firstDone] { ordered = firstDone.load(); }, nullptr, &first);
+        SKETCH_CHECK(ordered);
+        registered.join();
+    });
+    outside.join();
+}
+
+static void frameArenaPerThread() {
+    frameArena arena;
+    arena.begin();
+    SKETCH_CHECK(arena.getCount() >= 1);
+    std::vector<int> items(4096);
+    jobSystem::parallelFor(std::span<int>(items), 64, [&arena](const std::span<int> chunk) {
+        int* copy = static_cast<int*>(arena.local().allocate(chunk.size() * sizeof(int), alignof(int)));
+        for (size_t i = 0; i < chunk.size(); i++) copy[i] = static_cast<int>(i);
+        SKETCH_CHECK(copy[chunk.size() - 1] == static_cast<int>(chunk.size() - 1));
+    });
+    SKETCH_CHECK(arena.getUsedBytes() >= items.size() * sizeof(int));
+    arena.reset();
+    SKETCH_CHECK(arena.getUsedBytes() == 0);
+}
+
+void registerCoreTests(testSuite& suite) {
+    suite.add("mpscQueue/order and capacity", mpscQueueOrder);
+    suite.add("mpscQueue/concurrent producers", mpscQueueProducers);
+    suite.add("workStealingDeque/owner and thief ends", workStealingDequeEnds);
+    suite.add("workStealingDeque/concurrent thieves", workStealingDequeThieves);
+    suite.add("resourcePool/generations", resourcePoolGenerations);
+    suite.add("fixedTimestep/steps and alpha", fixedTimestepSteps);
+    suite.add("scaledClock/pause and scale", scaledClockPauseAndScale);
+    suite.add("snapshotQueue/two slots", [] { snapshotQueueHandoff(2); });
+    suite.add("snapshotQueue/three slots", [] { snapshotQueueHandoff(3); });
+    suite.add("linearArena/reset and reuse", linearArenaReuse);
+    suite.add("frameArena/per thread arenas", frameArenaPerThread);
+    suite.add("jobSystem/counters", jobCounters);
+    suite.add("jobSystem/dependencies", jobDependencies);
+    suite.add("jobSystem/inline fallback", jobInlineFallback);
+}
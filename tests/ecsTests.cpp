@@ -0,0 +1,103 @@
+#include "test.h"
+#include <atomic>
+#include <vector>
+#include "ecs/world.h"
+
+namespace {
+    struct position { float x, y; };
+    struct velocity { float x, y; };
+    struct health { int value; };
+    struct large { double values[200]; };  //few rows per chunk so tests cross chunk boundaries quickly
+}
+
+static void worldCreateAndGet() {
+    world entities;
+    const entity first = entities.create(position{ 1, 2 }, velocity{ 3, 4 });
+    const entity second = entities.create(position{ 5, 6 });
+    SKETCH_CHECK(entities.isAlive(first) && entities.isAlive(second));
+    SKETCH_CHECK(entities.get<position>(first)->x == 1 && entities.get<velocity>(first)->y == 4);
+    SKETCH_CHECK(entities.get<position>(second)->y == 6 && !entities.get<velocity>(second));
+    SKETCH_CHECK(entities.getEntityCount() == 2 && entities.getArchetypeCount() == 2);
+    SKETCH_CHECK(!entities.isAlive({}) && !entities.get<position>({}));
+}
+
+static void worldDestroyKeepsOthers() {
+    world entities;
+    std::vector<entity> created;
+    for (int i = 0; i < 100; i++) created.push_back(entities.create(health{ i }, large{}));
+    // removing from the middle moves the last entity into the hole, its handle has to follow it
+    for (int i = 0; i < 100; i += 3) entities.destroy(created[i]);
+    for (int i = 0; i < 100; i++) {
+        SKETCH_CHECK(entities.isAlive(created[i]) == (i % 3 != 0));
+        if (i % 3 != 0) SKETCH_CHECK(entities.get<health>(created[i])->value == i);
+    }
+    size_t visited = 0;
+    entities.each<const health>([&visited](const health&) { visited++; });
+    SKETCH_CHECK(visited == entities.getEntityCount() && visited == 66);
+
+    // a reused index gets a new generation so the old handle stays dead
+    const entity reused = entities.create(health{ -1 });
+    SKETCH_CHECK(reused.index() == created[99].index() && reused.generation() == created[99].generation() + 1);
+    SKETCH_CHECK(!entities.isAlive(created[99]) && entities.get<health>(reused)->value == -1);
+    entities.destroy(created[99]);
+    SKETCH_CHECK(entities.isAlive(reused));
+}
+
+static void worldAddRemoveMoves() {
+    world entities;
+    std::vector<entity> created;
+    for (int i = 0; i < 50; i++) created.push_back(entities.create(position{ static_cast<float>(i), 0 }, health{ i }));
+    for (int i = 0; i < 50; i += 2) entities.add(created[i], velocity{ 1, static_cast<float>(i) });
+    for (int i = 0; i < 50; i += 5) entities.remove<health>(created[i]);
+
+    // shared components survive the move between archetypes, the entities left behind are patched
+    for (int i = 0; i < 50; i++) {
+        SKETCH_CHECK(entities.get<position>(created[i])->x == static_cast<float>(i));
+        SKETCH_CHECK((entities.get<velocity>(created[i]) != nullptr) == (i % 2 == 0));
+        if (i % 2 == 0) SKETCH_CHECK(entities.get<velocity>(created[i])->y == static_cast<float>(i));
+        SKETCH_CHECK((entities.get<health>(created[i]) != nullptr) == (i % 5 != 0));
+        if (i % 5 != 0) SKETCH_CHECK(entities.get<health>(created[i])->value == i);
+    }
+    // adding a component the entity already has only overwrites it
+    entities.add(created[1], health{ 100 });
+    SKETCH_CHECK(entities.get<health>(created[1])->value == 100);
+    entities.remove<velocity>(created[1]);
+    SKETCH_CHECK(entities.get<health>(created[1])->value == 100);
+    SKETCH_CHECK(entities.getEntityCount() == 50);
+}
+
+static void worldQueries() {
+    world entities;
+    for (int i = 0; i < 1000; i++) {
+        if (i % 2) entities.create(position{ 1, 0 }, velocity{ 2, 0 });
+        else entities.create(position{ 1, 0 });
+    }
+    size_t chunkRows = 0;
+    for (const queryChunk& chunk : entities.query<const position, const velocity>()) {
+        chunkRows += chunk.count();
+        SKETCH_CHECK(chunk.get<velocity>()[0].x == 2);
+    }
+    SKETCH_CHECK(chunkRows == 500);
+
+    // const components share the id of the mutable type
+    float sum = 0;
+    entities.each<const position>([&sum](const position& placed) { sum += placed.x; });
+    SKETCH_CHECK(sum == 1000.0f);
+
+    std::atomic<int> moved = 0;
+    entities.parallelEach<position, const velocity>([&moved](position& placed, const velocity& moving) {
+        placed.x += moving.x;
+        moved.fetch_add(1, std::memory_order_relaxed);
+    });
+    SKETCH_CHECK(moved == 500);
+    sum = 0;
+    entities.each<const position>([&sum](const position& placed) { sum += placed.x; });
+    SKETCH_CHECK(sum == 2000.0f);
+}
+
+void registerEcsTests(testSuite& suite) {
+    suite.add("world/create and get", worldCreateAndGet);
+    suite.add("world/destroy keeps the others", worldDestroyKeepsOthers);
+    suite.add("world/add and remove move entities", worldAddRemoveMoves);
+    suite.add("world/queries", worldQueries);
+}
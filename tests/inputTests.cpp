@@ -0,0 +1,131 @@
+#include "test.h"
+#include <filesystem>
+#include <thread>
+#include <vector>
+#include "input/input.h"
+#include "input/inputRecorder.h"
+
+namespace {
+    // input is global, every test starts from a clean frame with nothing pressed or queued
+    void resetInput() {
+        for (int key = 0; key < static_cast<int>(input::KEY_COUNT); key++) input::onKeyEvent(key, GLFW_RELEASE);
+        for (int button = 0; button < static_cast<int>(input::MOUSE_COUNT); button++) input::onMouseButtonEvent(button, GLFW_RELEASE);
+        input::update(timestep(0.0f));
+        input::consumeEvents([](const inputEvent&) {});
+    }
+}
+
+static void buttonEdges() {
+    resetInput();
+    input::onKeyEvent(keycodes::space, GLFW_PRESS);
+    SKETCH_CHECK(input::getKey(keycodes::space) && input::getKeyDown(keycodes::space) && !input::getKeyUp(keycodes::space));
+    input::update(timestep(0.5f));
+    // held: no edges after the frame that saw the press, a repeat is not a new press
+    input::onKeyEvent(keycodes::space, GLFW_REPEAT);
+    SKETCH_CHECK(input::getKey(keycodes::space) && !input::getKeyDown(keycodes::space));
+    input::update(timestep(0.25f));
+    SKETCH_CHECK(input::getDuration(keycodes::space) == 0.75f);
+    input::onKeyEvent(keycodes::space, GLFW_RELEASE);
+    SKETCH_CHECK(!input::getKey(keycodes::space) && input::getKeyUp(keycodes::space));
+    input::update(timestep(0.5f));
+    SKETCH_CHECK(!input::getKeyUp(keycodes::space) && input::getDuration(keycodes::space) == 0.0f);
+
+    // a tap shorter than a frame still reports both edges for that frame
+    input::onMouseButtonEvent(mousecodes::left, GLFW_PRESS);
+    input::onMouseButtonEvent(mousecodes::left, GLFW_RELEASE);
+    SKETCH_CHECK(!input::getMouse(mousecodes::left));
+    SKETCH_CHECK(input::getMouseDown(mousecodes::left) && input::getMouseUp(mousecodes::left));
+    input::update(timestep(0.1f));
+    SKETCH_CHECK(!input::getMouseDown(mousecodes::left) && !input::getMouseUp(mousecodes::left));
+
+    // codes outside the table are ignored instead of indexing past it
+    input::onKeyEvent(-1, GLFW_PRESS);
+    input::onKeyEvent(static_cast<int>(input::KEY_COUNT), GLFW_PRESS);
+    SKETCH_CHECK(!input::getKey(-1) && !input::getKeyDown(static_cast<int>(input::KEY_COUNT)));
+    resetInput();
+}
+
+static void timestampedEvents() {
+    resetInput();
+    // posted from another thread, the events keep the time they were posted at rather than when they are applied
+    std::thread window([] {
+        for (int i = 0; i < 3; i++) {
+            input::postEvent({ inputEventType::KEY, keycodes::a + i, GLFW_PRESS, 0.0f, 0.0f, 100 + i * 100 });
+        }
+    });
+    window.join();
+    SKETCH_CHECK(input::processPostedEvents() == 3);
+    SKETCH_CHECK(input::getKey(keycodes::c) && input::getOldestEventTime() == 100);
+
+    // a fixed tick only takes what happened before its end, the rest waits for the next tick
+    std::vector<int> codes;
+    SKETCH_CHECK(input::consumeEventsUntil(250, [&](const inputEvent& event) { codes.push_back(event.code); }) == 2);
+    SKETCH_CHECK(codes == std::vector<int>({ keycodes::a, keycodes::b }));
+    SKETCH_CHECK(input::getOldestEventTime() == 300);
+    SKETCH_CHECK(input::consumeEvents([&](const inputEvent& event) { codes.push_back(event.code); }) == 1);
+    SKETCH_CHECK(codes.back() == keycodes::c && input::getOldestEventTime() == -1);
+
+    // nobody consuming: the ring keeps the newest events and counts what it overwrote
+    inputEventQueue queue;
+    for (int i = 0; i < static_cast<int>(inputEventQueue::CAPACITY) + 10; i++) {
+        queue.push({ inputEventType::MOUSE_WHEEL, 0, 0, 0.0f, 0.0f, i });
+    }
+    SKETCH_CHECK(queue.size() == inputEventQueue::CAPACITY && queue.getDroppedCount() == 10);
+    SKETCH_CHECK(queue.oldest()->timeNs == 10);
+    resetInput();
+}
+
+static void recordReplayRoundTrip() {
+    const std::string path = (std::filesystem::temp_directory_path() / "sketch_test_session.input").string();
+    constexpr uint32_t FRAMES = 6;
+    // uneven frame times, a replay has to reproduce each of them rather than a fixed rate
+    const int64_t deltas[FRAMES] = { 16'000'000, 33'500'000, 8'250'000, 16'666'667, 50'000'000, 1 };
+    struct frameState {
+        bool down = false;
+        bool pressed = false;
+        bool released = false;
+        std::pair<float, float> mouse;
+    };
+    frameState recorded[FRAMES];
+
+    resetInput();
+    inputRecorder recorder;
+    SKETCH_CHECK(recorder.start(path));
+    for (uint32_t frame = 0; frame < FRAMES; frame++) {
+        if (frame == 1) input::onKeyEvent(keycodes::w, GLFW_PRESS);
+        if (frame == 2) input::onMouseMoveEvent(12.5f, -3.0f);
+        if (frame == 4) {
+            input::onKeyEvent(keycodes::w, GLFW_RELEASE);
+            input::onKeyEvent(keycodes::w, GLFW_PRESS);
+        }
+        recorder.record(frame, timestep::fromTicks(deltas[frame]));
+        recorded[frame] = { input::getKey(keycodes::w), input::getKeyDown(keycodes::w), input::getKeyUp(keycodes::w), input::getMousePosition() };
+        input::update(timestep::fromTicks(deltas[frame]));
+    }
+    recorder.stop(FRAMES);
+    SKETCH_CHECK(!recorder.isRecording());
+
+    resetInput();
+    input::onMouseMoveEvent(0.0f, 0.0f);
+    inputReplay replay;
+    SKETCH_CHECK(replay.open(path));
+    uint32_t frame = 0;
+    for (; !replay.finished(frame) && frame < FRAMES; frame++) {
+        const timestep deltaTime = replay.feed(frame);
+        SKETCH_CHECK(deltaTime.getTicks() == deltas[frame]);
+        SKETCH_CHECK(input::getKey(keycodes::w) == recorded[frame].down);
+        SKETCH_CHECK(input::getKeyDown(keycodes::w) == recorded[frame].pressed);
+        SKETCH_CHECK(input::getKeyUp(keycodes::w) == recorded[frame].released);
+        SKETCH_CHECK(input::getMousePosition() == recorded[frame].mouse);
+        input::update(deltaTime);
+    }
+    SKETCH_CHECK(frame == FRAMES && replay.finished(frame));
+    std::filesystem::remove(path);
+    resetInput();
+}
+
+void registerInputTests(testSuite& suite) {
+    suite.add("input/button edges", buttonEdges);
+    suite.add("input/timestamped events", timestampedEvents);
+    suite.add("input/record replay round trip", recordReplayRoundTrip);
+}
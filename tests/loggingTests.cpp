@@ -0,0 +1,204 @@
+#include "test.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/binaryLog.h"
+#include "logging/fileSink.h"
+#include "logging/logBackend.h"
+
+namespace {
+    // keeps the messages of one category, the harness logs to CORE so its own output stays out
+    class captureSink : public logSink {
+    public:
+        void write(const logRecord& record) override {
+            if (record.category != LogCategory::ASSET) return;
+            std::lock_guard lock(_mutex);
+            _messages.emplace_back(record.message());
+        }
+        void flush() override {}
+        std::vector<std::string> take() {
+            std::lock_guard lock(_mutex);
+            return std::move(_messages);
+        }
+    private:
+        std::mutex _mutex;
+        std::vector<std::string> _messages;
+    };
+
+    // builds the record a deferred call site would submit, with the bytes encoded the same way
+    template <typename... Args>
+    logRecord deferredRecord(const std::string_view format, const Args&... args) {
+        logRecord record;
+        record.category = LogCategory::ASSET;
+        record.time = std::chrono::system_clock::now();
+        size_t used = 0;
+        SKETCH_CHECK(logArgs::encode(record.text.data(), record.text.size(), used, args...));
+        record.length = static_cast<uint32_t>(used);
+        record.format = format;
+        record.decode = &logArgs::decode<Args...>;
+        record.argTypes = logArgs::types<Args...>;
+        record.argCount = sizeof...(Args);
+        return record;
+    }
+
+    template <typename... Args>
+    void checkRoundTrip(const std::string_view format, const Args&... args) {
+        const std::string expected = std::vformat(format, std::make_format_args(args...));
+        logRecord record = deferredRecord(format, args...);
+        record.resolve();
+        SKETCH_CHECK(record.message() == expected);
+        // the offline decoder only has the type tags, it has to produce the same text
+        const std::string offline = logArgs::formatRuntime(format, std::span(logArgs::types<Args...>, sizeof...(Args)), record.text.data());
+        SKETCH_CHECK(offline == expected);
+    }
+}
+
+static void logArgsRoundTrip() {
+    checkRoundTrip("no arguments");
+    checkRoundTrip("{} {} {}", true, 'x', -7);
+    checkRoundTrip("{:#x} {:>8}", 0xdeadbeefu, int64_t(-1) << 40);
+    checkRoundTrip("{} {:.3f} {:e}", uint64_t(1) << 63, 2.5f, -1.0 / 3.0);
+    const std::string owned = "owned";
+    const std::string_view view = "view";
+    checkRoundTrip("[{}] [{:<6}] [{}]", "literal", owned, view);
+    checkRoundTrip("{}", static_cast<const void*>(&owned));
+
+    // arguments that do not fit are rejected, the logger then formats the message eagerly
+    char small[8];
+    size_t used = 0;
+    SKETCH_CHECK(!logArgs::encode(small, sizeof(small), used, int64_t(1), int64_t(2)));
+    SKETCH_CHECK(!logArgs::encode(small, sizeof(small), used, std::string("too long for it")));
+}
+
+static void binaryLogRoundTrip() {
+    const std::string path = (std::filesystem::temp_directory_path() / "sketch_test_binary.sklog").string();
+    std::vector<std::string> expected;
+    {
+        binaryFileSink sink(path);
+        for (int i = 0; i < 3; i++) {
+            // the same call site reuses its stored format
+            sink.write(deferredRecord("frame {} took {:.2f} ms", i, 16.5 + i));
+            expected.push_back(std::format("frame {} took {:.2f} ms", i, 16.5 + i));
+        }
+        logRecord text;
+        text.level = LogLevel::WARN;
+        text.category = LogCategory::RENDER;
+        text.overflow = "already formatted";
+        sink.write(text);
+        expected.push_back(text.overflow);
+        sink.write(deferredRecord("{} {}", "name", -3));
+        expected.push_back("name -3");
+    }
+
+    std::vector<std::string> messages;
+    std::vector<LogCategory> categories;
+    SKETCH_CHECK(readBinaryLog(path, [&](const logRecord& record) {
+        messages.emplace_back(record.message());
+        categories.push_back(record.category);
+    }));
+    std::filesystem::remove(path);
+    SKETCH_CHECK(messages == expected);
+    SKETCH_CHECK(categories.size() == 5 && categories[3] == LogCategory::RENDER && categories[4] == LogCategory::ASSET);
+}
+
+static void asyncLoggingDelivers() {
+    constexpr int THREADS = 4;
+    constexpr int PER_THREAD = 5000;  //more than the queue holds, so producers also wait for room
+    // the capture sink stands in for the console while the test runs, the messages would flood it
+    const auto sink = std::make_shared<captureSink>();
+    logBackend::clearSinks();
+    logBackend::addSink(sink);
+    logBackend::startAsync();
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < THREADS; thread++) {
+        threads.emplace_back([thread] {
+            logger<LogCategory::ASSET> log;
+            for (int i = 0; i < PER_THREAD; i++) log.info("{} {}", thread, i);
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    logBackend::flush();
+    logBackend::stopAsync();
+    logBackend::clearSinks();
+    logBackend::addSink(std::make_shared<consoleSink>());
+
+    // everything arrives once, and each thread's messages keep the order they were logged in
+    const std::vector<std::string> messages = sink->take();
+    SKETCH_CHECK(messages.size() == THREADS * PER_THREAD);
+    std::vector<int> next(THREADS, 0);
+    for (const std::string& message : messages) {
+        int thread = -1, index = -1;
+        SKETCH_CHECK(std::sscanf(message.c_str(), "%d %d", &thread, &index) == 2);
+        if (thread < 0 || thread >= THREADS) continue;
+        SKETCH_CHECK(index == next[thread]);
+        next[thread] = index + 1;
+    }
+}
+
+static void fileSinkRotation() {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "sketch_test_rotation";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const std::string path = (directory / "engine.log").string();
+
+    constexpr int RECORDS = 40;
+    fileSinkSettings settings;
+    settings.maxBytes = 256;
+    settings.maxAge = std::chrono::minutes(0);
+    settings.keepFiles = 2;
+    settings.bufferSize = 64;
+    {
+        fileSink sink(path, settings);
+        SKETCH_CHECK(sink.isOpen());
+        for (int i = 0; i < RECORDS; i++) {
+            logRecord record;
+            record.time = std::chrono::system_clock::now();
+            record.overflow = std::format("record {}", i);
+            sink.write(record);
+        }
+    }
+
+    // numbers of the records in a file, in the order they were written
+    const auto readRecords = [](const std::string& file) {
+        std::vector<int> numbers;
+        std::ifstream stream(file);
+        std::string line;
+        while (std::getline(stream, line)) {
+            const size_t at = line.rfind("record ");
+            if (at != std::string::npos) numbers.push_back(std::stoi(line.substr(at + 7)));
+        }
+        return numbers;
+    };
+
+    // only keepFiles rotated files survive, none of them over the limit
+    SKETCH_CHECK(std::filesystem::exists(path + ".1"));
+    SKETCH_CHECK(std::filesystem::exists(path + ".2"));
+    SKETCH_CHECK(!std::filesystem::exists(path + ".3"));
+    for (const std::string& file : { path, path + ".1", path + ".2" }) {
+        SKETCH_CHECK(std::filesystem::file_size(file) <= settings.maxBytes);
+    }
+
+    // oldest to newest the files hold one unbroken run of records ending with the last one written
+    std::vector<int> numbers;
+    for (const std::string& file : { path + ".2", path + ".1", path }) {
+        const std::vector<int> part = readRecords(file);
+        SKETCH_CHECK(!part.empty());
+        numbers.insert(numbers.end(), part.begin(), part.end());
+    }
+    SKETCH_CHECK(!numbers.empty() && numbers.back() == RECORDS - 1);
+    for (size_t i = 1; i < numbers.size(); i++) {
+        SKETCH_CHECK(numbers[i] == numbers[i - 1] + 1);
+    }
+    std::filesystem::remove_all(directory);
+}
+
+void registerLoggingTests(testSuite& suite) {
+    suite.add("logArgs/encode decode round trip", logArgsRoundTrip);
+    suite.add("binaryLog/write read round trip", binaryLogRoundTrip);
+    suite.add("fileSink/size rotation", fileSinkRotation);
+    suite.add("logBackend/async delivery and order", asyncLoggingDelivers);
+}
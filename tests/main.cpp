@@ -0,0 +1,25 @@
+#include "test.h"
+#include "core/jobSystem.h"
+
+// usage: sketch_tests [--filter=substring], exits non zero when any test fails
+int main(const int argc, char** argv) {
+    logger<> log;
+    std::string filter;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg.starts_with("--filter=")) filter = arg.substr(9);
+        else log.warn("Unknown argument: {}", arg);
+    }
+
+    testSuite suite;
+    registerLoggingTests(suite);
+    registerCoreTests(suite);
+    registerInputTests(suite);
+    registerEcsTests(suite);
+    registerRenderingTests(suite);
+    jobSystem::init();
+    const int failed = suite.run(filter);
+    jobSystem::shutdown();
+    logBackend::flush();
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,52 @@
+#include "test.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "core/jobSystem.h"
+#include "rendering/commandBuffer.h"
+
+namespace {
+    std::vector<std::pair<uint64_t, uint32_t>> orderOf(const std::span<const drawPacket> packets) {
+        std::vector<std::pair<uint64_t, uint32_t>> order;
+        for (const drawPacket& packet : packets) order.emplace_back(packet.sortKey, packet.object);
+        return order;
+    }
+}
+
+static void mergeOrderIndependent() {
+    // few distinct keys, so most of the order comes from the object tie break
+    std::vector<drawPacket> packets(2000);
+    for (uint32_t i = 0; i < packets.size(); i++) {
+        packets[i].sortKey = (i * 7919u) % 5;
+        packets[i].object = i;
+    }
+
+    frameArena arena;
+    commandQueue queue;
+    std::vector<std::pair<uint64_t, uint32_t>> first;
+    std::mt19937 random(7);
+    for (int run = 0; run < 4; run++) {
+        // every run records in another order and, in parallel, spreads the packets over other threads
+        std::shuffle(packets.begin(), packets.end(), random);
+        arena.begin();
+        queue.begin(arena);
+        if (run % 2) {
+            jobSystem::parallelFor(std::span<drawPacket>(packets), 32, [&queue](const std::span<drawPacket> chunk) {
+                commandBuffer& buffer = queue.local();
+                for (const drawPacket& packet : chunk) buffer.draw(packet);
+            });
+        } else {
+            for (const drawPacket& packet : packets) queue.local().draw(packet);
+        }
+        const std::vector<std::pair<uint64_t, uint32_t>> order = orderOf(queue.merge());
+        SKETCH_CHECK(order.size() == packets.size());
+        SKETCH_CHECK(std::is_sorted(order.begin(), order.end()));
+        if (run == 0) first = order;
+        SKETCH_CHECK(order == first);
+        arena.reset();
+    }
+}
+
+void registerRenderingTests(testSuite& suite) {
+    suite.add("commandQueue/merge order independence", mergeOrderIndependent);
+}
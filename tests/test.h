@@ -0,0 +1,57 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+#include "logging/logger.h"
+
+// failed checks are logged and counted, the test keeps running so one run reports every broken expectation
+// safe to use from job system workers and other threads the test starts
+#define SKETCH_CHECK(condition)                                              \
+    do {                                                                     \
+        if (!(condition)) testSuite::fail(#condition, __FILE__, __LINE__);   \
+    } while (0)
+
+// TEST SUITE - minimal in-tree harness, tests are registered by name and run in order, headless only
+class testSuite {
+public:
+    using function = std::function<void()>;
+
+    void add(std::string name, function body) {
+        _tests.push_back({ std::move(name), std::move(body) });
+    }
+
+    // returns the number of failed tests
+    int run(const std::string& filter) {
+        int failed = 0, ran = 0;
+        for (auto& [name, body] : _tests) {
+            if (!filter.empty() && name.find(filter) == std::string::npos) continue;
+            const uint64_t before = _failures.load();
+            body();
+            ran++;
+            if (_failures.load() != before) {
+                failed++;
+                _log.warn("FAIL {}", name);
+            } else {
+                _log.info("pass {}", name);
+            }
+        }
+        _log.info("{} of {} tests passed", ran - failed, ran);
+        return failed;
+    }
+
+    static void fail(const char* condition, const char* file, const int line) {
+        _failures.fetch_add(1);
+        _log.warn("{}:{} check failed: {}", file, line, condition);
+    }
+private:
+    std::vector<std::pair<std::string, function>> _tests;
+    static inline std::atomic<uint64_t> _failures = 0;
+    static inline logger<> _log;
+};
+
+void registerLoggingTests(testSuite& suite);
+void registerCoreTests(testSuite& suite);
+void registerInputTests(testSuite& suite);
+void registerEcsTests(testSuite& suite);
+void registerRenderingTests(testSuite& suite);
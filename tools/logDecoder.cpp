@@ -0,0 +1,20 @@
+#include "logging/binaryLog.h"
+
+// usage: sketch_logdecode <binary log file>
+// prints a binary log written by binaryFileSink the same way the console sink would have
+int main(const int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <binary log file>\n", argv[0]);
+        return 1;
+    }
+    consoleSink console;
+    const bool complete = readBinaryLog(argv[1], [&console](const logRecord& record) {
+        console.write(record);
+    });
+    console.flush();
+    if (!complete) {
+        std::fprintf(stderr, "%s is not a binary log or ends with a truncated record\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}